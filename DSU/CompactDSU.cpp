@@ -0,0 +1,76 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+ * COMPACT DSU - Union-Find in a single array, no recursion
+ *
+ * Template:
+ *   I - Signed index type (int32_t by default, int64_t for more than 2^31 - 1 elements)
+ *
+ * Constructor:
+ *   CompactDSU<>(n)     - Creates n disjoint sets (0 to n-1)
+ *   CompactDSU<>(r, c)  - Creates r*c sets for 2D grid
+ *
+ * Functions:
+ *   find(a)           - Find representative of set containing a (iterative path halving)
+ *   merge(a, b)       - Union sets containing a and b, returns true if merged
+ *   sameSet(a, b)     - Returns true if a and b are in same set
+ *   getSetSize(a)     - Returns size of set containing a
+ *
+ *   For 2D grid version:
+ *   get_id(r, c)       - Id of cell (r, c)
+ *   find(r, c)         - Find representative of cell (r, c)
+ *   merge(r1,c1,r2,c2) - Union cells (r1,c1) and (r2,c2)
+ *
+ * p[a] >= 0 is the parent of a; p[a] < 0 marks a root whose set has size -p[a].
+ * One I per element (4 bytes with the default), instead of separate parent and size arrays.
+ *
+ * Time: O(α(n)) per operation (union by size + path halving)
+ */
+
+template<typename I = int32_t>
+struct CompactDSU {
+    vector<I> p;
+    I numberOfSets;
+    I C;
+
+    CompactDSU(I n) : C(0) { init(n); }
+    CompactDSU(I r, I c) : C(c) { init(r * c); }
+
+    void init(I n) {
+        p.assign(n, -1);
+        numberOfSets = n;
+    }
+
+    // -------------------------------------------
+    I get_id(I r, I c) { return r * C + c; }
+    I find(I r, I c) { return find(get_id(r, c)); }
+    bool merge(I r1, I c1, I r2, I c2) {
+        return merge(get_id(r1, c1), get_id(r2, c2));
+    }
+    // -------------------------------------------
+    I find(I a) {
+        while (p[a] >= 0) {
+            I q = p[a];
+            if (p[q] >= 0) p[a] = p[q]; // Path halving
+            a = p[a];
+        }
+        return a;
+    }
+    bool merge(I a, I b) {
+        a = find(a); b = find(b);
+        if (a == b) return false;
+        if (p[a] > p[b]) swap(a, b);
+        p[a] += p[b];
+        p[b] = a;
+        numberOfSets--;
+        return true;
+    }
+    // -------------------------------------------
+    bool sameSet(I a, I b) {
+        return find(a) == find(b);
+    }
+    I getSetSize(I a) {
+        return -p[find(a)];
+    }
+};
@@ -0,0 +1,93 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+#define pii pair<int, int>
+
+/*
+ * CONCURRENT DSU - Lock-free Union-Find, safe to call from many threads at once
+ *
+ * Constructor:
+ *   ConcurrentDSU(n)     - Creates n disjoint sets (0 to n-1)
+ *   ConcurrentDSU(r, c)  - Creates r*c sets for 2D grid
+ *
+ * Functions (all thread-safe):
+ *   find(a)                      - Representative of the set containing a (path halving)
+ *   merge(a, b)                  - Union sets of a and b, returns true if this call merged them
+ *   sameSet(a, b)                - Returns true if a and b are in the same set
+ *   parallel_merge(edges, th)    - Merge every (u, v) in edges using th threads,
+ *                                  returns how many merges succeeded
+ *   get_id(r, c)                 - Grid cell (r, c) -> element id
+ *
+ * Roots are linked by index (larger root under smaller) with a single CAS on the
+ * parent slot, and find() shortcuts parent -> grandparent with a weak CAS.
+ * Set sizes are not tracked; count them with find() after the parallel phase.
+ * Compile with -pthread.
+ *
+ * Time: near-constant amortized per operation in practice (relabel ids with a random
+ *       permutation to get the expected O(log n) bound of randomized linking)
+ */
+
+struct ConcurrentDSU {
+    vector<atomic<int>> parent;
+    atomic<int> numberOfSets;
+    int R, C;
+
+    ConcurrentDSU(int n) : parent(n) { init(n); }
+    ConcurrentDSU(int r, int c) : parent(r * c) { R = r; C = c; init(r * c); }
+
+    void init(int n) {
+        for (int i = 0; i < n; i++) parent[i].store(i, memory_order_relaxed);
+        numberOfSets = n;
+    }
+
+    int get_id(int r, int c) { return r * C + c; }
+
+    int find(int a) {
+        while (true) {
+            int p = parent[a].load(memory_order_acquire);
+            if (p == a) return a;
+            int gp = parent[p].load(memory_order_acquire);
+            if (p != gp) parent[a].compare_exchange_weak(p, gp, memory_order_release, memory_order_relaxed);
+            a = gp;
+        }
+    }
+
+    bool merge(int a, int b) {
+        while (true) {
+            a = find(a); b = find(b);
+            if (a == b) return false;
+            if (a < b) swap(a, b);
+            int expected = a;
+            if (parent[a].compare_exchange_strong(expected, b, memory_order_acq_rel)) {
+                numberOfSets--;
+                return true;
+            }
+        }
+    }
+
+    bool sameSet(int a, int b) {
+        while (true) {
+            a = find(a); b = find(b);
+            if (a == b) return true;
+            if (parent[a].load(memory_order_acquire) == a) return false;
+        }
+    }
+
+    long long parallel_merge(const vector<pii>& edges, int threads = thread::hardware_concurrency()) {
+        threads = max(1, threads);
+        atomic<long long> merged(0);
+        size_t m = edges.size(), chunk = (m + threads - 1) / threads;
+        vector<thread> pool;
+        for (int t = 0; t < threads; t++) {
+            size_t lo = t * chunk, hi = min(m, lo + chunk);
+            if (lo >= hi) break;
+            pool.emplace_back([&, lo, hi] {
+                long long local = 0;
+                for (size_t i = lo; i < hi; i++) local += merge(edges[i].first, edges[i].second);
+                merged += local;
+            });
+        }
+        for (auto& th : pool) th.join();
+        return merged;
+    }
+};
@@ -0,0 +1,149 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+#define vi vector<int>
+#define pii pair<int, int>
+#define all(v) v.begin(), v.end()
+
+/*
+ * OFFLINE DYNAMIC CONNECTIVITY - Add edge / remove edge / "connected?" on a timeline
+ *
+ * Constructor:
+ *   DynamicConnectivity(n) - Graph with n nodes (0 to n-1) and no edges
+ *
+ * Functions (record the timeline, then solve once):
+ *   addEdge(u, v)     - Add edge (u, v) (multi-edges allowed)
+ *   removeEdge(u, v)  - Remove one copy of edge (u, v), which must currently exist
+ *   query(u, v)       - Ask whether u and v are connected at this moment
+ *   solve()           - Returns the answers of all query() calls, in order
+ *
+ * Each edge lives on a time interval [added, removed). The interval is stored on
+ * O(log q) nodes of a segment tree over time, which is walked with an explicit
+ * stack (no recursion); a RollbackDSU applies a node's edges on entry and
+ * reverts them on exit.
+ *
+ * Time: O(q log q log n) for q events
+ */
+
+struct RollbackDSU {
+    vi parent, sz;
+    struct Step { int u, v; };
+    vector<Step> history;
+    int numberOfSets;
+
+    RollbackDSU(int n) {
+        parent.resize(n);
+        iota(all(parent), 0);
+        sz.assign(n, 1);
+        numberOfSets = n;
+    }
+
+    int find(int a) {
+        while (a != parent[a]) a = parent[a];
+        return a;
+    }
+
+    bool merge(int a, int b) {
+        a = find(a); b = find(b);
+        if (a == b) return false;
+        if (sz[a] < sz[b]) swap(a, b);
+        history.push_back({a, b});
+        parent[b] = a;
+        sz[a] += sz[b];
+        numberOfSets--;
+        return true;
+    }
+
+    void rollback() {
+        Step last = history.back();
+        history.pop_back();
+        sz[last.u] -= sz[last.v];
+        parent[last.v] = last.v;
+        numberOfSets++;
+    }
+
+    int time() { return (int)history.size(); }
+    void revert(int t) {
+        while ((int)history.size() > t) rollback();
+    }
+};
+
+struct DynamicConnectivity {
+    struct Event { int type, u, v; }; // 0 = add, 1 = remove, 2 = query
+    int n;
+    vector<Event> events;
+
+    DynamicConnectivity(int n) : n(n) {}
+
+    void addEdge(int u, int v) { events.push_back({0, min(u, v), max(u, v)}); }
+    void removeEdge(int u, int v) { events.push_back({1, min(u, v), max(u, v)}); }
+    void query(int u, int v) { events.push_back({2, u, v}); }
+
+    vector<bool> solve() {
+        int q = events.size();
+        int size = 1;
+        while (size < max(q, 1)) size <<= 1;
+
+        // Edge lifetimes [start, end) over event indices
+        vector<array<int, 4>> spans; // {start, end, u, v}
+        map<pii, vi> open;
+        for (int t = 0; t < q; t++) {
+            Event& e = events[t];
+            if (e.type == 0) {
+                open[{e.u, e.v}].push_back(t);
+            } else if (e.type == 1) {
+                vi& st = open[{e.u, e.v}];
+                spans.push_back({st.back(), t, e.u, e.v});
+                st.pop_back();
+            }
+        }
+        for (auto& [edge, st] : open)
+            for (int s : st) spans.push_back({s, q, edge.first, edge.second});
+
+        // Bucket every span on its canonical nodes (CSR layout)
+        vi start(2 * size + 1, 0);
+        auto forNodes = [&](int l, int r, auto&& f) {
+            for (l += size, r += size; l < r; l >>= 1, r >>= 1) {
+                if (l & 1) f(l++);
+                if (r & 1) f(--r);
+            }
+        };
+        for (auto& s : spans) forNodes(s[0], s[1], [&](int v) { start[v + 1]++; });
+        for (int v = 0; v < 2 * size; v++) start[v + 1] += start[v];
+        vector<pii> edges(start[2 * size]);
+        vi fill(start.begin(), start.end() - 1);
+        for (auto& s : spans) forNodes(s[0], s[1], [&](int v) { edges[fill[v]++] = {s[2], s[3]}; });
+
+        // Queries before time t, to skip subtrees without any query
+        vi queriesBefore(size + 1, 0);
+        for (int t = 0; t < size; t++)
+            queriesBefore[t + 1] = queriesBefore[t] + (t < q && events[t].type == 2);
+
+        // Iterative DFS: a negative entry means "leave node -v"
+        RollbackDSU dsu(n);
+        vector<bool> answers;
+        vi savedTime(2 * size);
+        vi st = {1};
+        while (!st.empty()) {
+            int v = st.back();
+            st.pop_back();
+            if (v < 0) {
+                dsu.revert(savedTime[-v]);
+                continue;
+            }
+            int h = 31 - __builtin_clz(v), span = size >> h, lo = (v - (1 << h)) * span;
+            if (queriesBefore[lo + span] == queriesBefore[lo]) continue;
+            savedTime[v] = dsu.time();
+            for (int i = start[v]; i < start[v + 1]; i++) dsu.merge(edges[i].first, edges[i].second);
+            st.push_back(-v);
+            if (v >= size) {
+                int t = v - size;
+                answers.push_back(dsu.find(events[t].u) == dsu.find(events[t].v));
+            } else {
+                st.push_back(2 * v + 1);
+                st.push_back(2 * v);
+            }
+        }
+        return answers;
+    }
+};
@@ -0,0 +1,122 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+#define vi vector<int>
+#define all(v) v.begin(), v.end()
+
+/*
+ * GROUP WEIGHTED DSU - DSU with potentials in any group (sum, xor, mod p, affine maps...)
+ *
+ * Template:
+ *   T   - Group element type (needs operator==)
+ *   op  - Group operation: T op(T x, T y) (does NOT need to be commutative)
+ *   inv - Inverse:         T inv(T x)
+ *   e   - Identity:        T e()
+ *
+ * Every element a has a potential P(a) (P(root) = e()). A constraint (a, b, w) means
+ * P(b) = op(P(a), w), i.e. w = op(inv(P(a)), P(b)).
+ *
+ * Constructor:
+ *   GroupWeightedDSU<T, op, inv, e>(n) - Creates n disjoint sets (0 to n-1)
+ *
+ * Functions:
+ *   find(a)               - Representative of the set of a (iterative, O(1) extra memory)
+ *   potential(a)          - P(a) relative to its representative
+ *   merge(a, b, w)        - Add constraint (a, b, w). Returns false if a and b were already
+ *                           in the same set (the constraint is then NOT checked)
+ *   addConstraint(a,b,w)  - Merge, or check against the known difference. False on contradiction
+ *   firstContradiction(first, last)
+ *                         - Streams (a, b, w) tuples through addConstraint, returns the index
+ *                           of the first contradiction, or -1 if all are consistent
+ *   get_diff(a, b)        - op(inv(P(a)), P(b)) if a and b are connected, nullopt otherwise
+ *   sameSet(a, b), getSetSize(a)
+ *
+ * USAGE (parity constraints):
+ *   int op(int x, int y) { return x ^ y; }
+ *   int inv(int x) { return x; }
+ *   int e() { return 0; }
+ *   GroupWeightedDSU<int, op, inv, e> dsu(n);
+ *   long long bad = dsu.firstContradiction(cs.begin(), cs.end()); // cs: vector<tuple<int,int,int>>
+ *
+ * Time: O(α(n)) per operation
+ */
+
+template<typename T, T (*op)(T, T), T (*inv)(T), T (*e)()>
+struct GroupWeightedDSU {
+    vi parent, sz;
+    vector<T> pot;
+    int numberOfSets;
+
+    GroupWeightedDSU(int n) {
+        parent.resize(n);
+        iota(all(parent), 0);
+        sz.assign(n, 1);
+        pot.assign(n, e());
+        numberOfSets = n;
+    }
+
+    int find(int a) {
+        // Pass 1: P(a) and the root
+        int root = a;
+        T acc = e();
+        while (root != parent[root]) {
+            acc = op(pot[root], acc);
+            root = parent[root];
+        }
+        // Pass 2: hang every node of the path on the root, walking P back up with inv
+        while (a != root && parent[a] != root) {
+            int next = parent[a];
+            T up = op(acc, inv(pot[a]));
+            pot[a] = acc;
+            parent[a] = root;
+            acc = up;
+            a = next;
+        }
+        return root;
+    }
+
+    T potential(int a) {
+        find(a);
+        return parent[a] == a ? e() : pot[a];
+    }
+
+    bool merge(int a, int b, T w) {
+        int ra = find(a), rb = find(b);
+        if (ra == rb) return false;
+        T pa = potential(a), pb = potential(b);
+        if (sz[ra] < sz[rb]) {
+            parent[ra] = rb;
+            pot[ra] = op(op(pb, inv(w)), inv(pa));
+            sz[rb] += sz[ra];
+        } else {
+            parent[rb] = ra;
+            pot[rb] = op(op(pa, w), inv(pb));
+            sz[ra] += sz[rb];
+        }
+        numberOfSets--;
+        return true;
+    }
+
+    bool addConstraint(int a, int b, T w) {
+        if (merge(a, b, w)) return true;
+        return op(inv(potential(a)), potential(b)) == w;
+    }
+
+    template<typename It>
+    long long firstContradiction(It first, It last) {
+        long long idx = 0;
+        for (; first != last; ++first, ++idx) {
+            const auto& [a, b, w] = *first;
+            if (!addConstraint(a, b, w)) return idx;
+        }
+        return -1;
+    }
+
+    optional<T> get_diff(int a, int b) {
+        if (find(a) != find(b)) return nullopt;
+        return op(inv(potential(a)), potential(b));
+    }
+
+    bool sameSet(int a, int b) { return find(a) == find(b); }
+    int getSetSize(int a) { return sz[find(a)]; }
+};
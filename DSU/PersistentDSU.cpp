@@ -0,0 +1,79 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+#define vi vector<int>
+#define pii pair<int, int>
+#define all(v) v.begin(), v.end()
+
+/*
+ * PARTIALLY PERSISTENT DSU - Ask "were a and b connected at time t?" for any past t
+ *
+ * Constructor:
+ *   PersistentDSU(n)     - Creates n disjoint sets (0 to n-1) at time 0
+ *
+ * Functions:
+ *   merge(a, b)          - Union sets of a and b at time time() + 1. Every call advances
+ *                          the clock (even if a and b were already joined); returns true if merged
+ *   time()               - Number of merge calls so far (the current time)
+ *   find(a, t)           - Representative of a's set after the first t merge calls
+ *   sameSet(a, b, t)     - True if a and b were in the same set at time t
+ *   getSetSize(a, t)     - Size of a's set at time t
+ *   find(a), sameSet(a, b), getSetSize(a) - Same, at the current time
+ *
+ * Union by rank, no path compression: a parent link never changes once set and stores
+ * the time it was made, so find(a, t) just stops at the first link made after t.
+ * Each root keeps its (time, size) history for getSetSize.
+ *
+ * Time: O(log n) per query (getSetSize: O(log n) more for the binary search)
+ */
+
+struct PersistentDSU {
+    vi parent, rnk, since;
+    vector<vector<pii>> sizes; // sizes[root] = {(time, size), ...}
+    int numberOfSets;
+    int now;
+
+    PersistentDSU(int n) {
+        parent.resize(n);
+        iota(all(parent), 0);
+        rnk.assign(n, 0);
+        since.assign(n, INT_MAX);
+        sizes.assign(n, {{0, 1}});
+        numberOfSets = n;
+        now = 0;
+    }
+
+    int time() { return now; }
+
+    int find(int a, int t) {
+        while (parent[a] != a && since[a] <= t) a = parent[a];
+        return a;
+    }
+
+    bool merge(int a, int b) {
+        now++;
+        a = find(a, now); b = find(b, now);
+        if (a == b) return false;
+        if (rnk[a] < rnk[b]) swap(a, b);
+        if (rnk[a] == rnk[b]) rnk[a]++;
+        parent[b] = a;
+        since[b] = now;
+        sizes[a].push_back({now, sizes[a].back().second + sizes[b].back().second});
+        numberOfSets--;
+        return true;
+    }
+
+    bool sameSet(int a, int b, int t) {
+        return find(a, t) == find(b, t);
+    }
+
+    int getSetSize(int a, int t) {
+        const vector<pii>& h = sizes[find(a, t)];
+        auto it = upper_bound(all(h), pii(t, INT_MAX));
+        return prev(it)->second;
+    }
+
+    int find(int a) { return find(a, now); }
+    bool sameSet(int a, int b) { return sameSet(a, b, now); }
+    int getSetSize(int a) { return getSetSize(a, now); }
+};
@@ -0,0 +1,60 @@
+/**
+ * DISJOINT SPARSE TABLE (Generic)
+ * -------------------------------
+ * Static Range Queries in O(1) for ANY ASSOCIATIVE function: sum, xor, product mod p,
+ * matrix product... (the function does NOT need to be idempotent or commutative).
+ *
+ * USAGE:
+ *   DisjointSparseTable<long long> dst(vec); // Defaults to sum
+ *   DisjointSparseTable<long long> dst(vec, [](long long a, long long b) { return a * b % MOD; });
+ *   dst.query(l, r)                          // a[l] op ... op a[r]
+ *
+ *   For speed, pass the functor type instead of using std::function:
+ *   auto mul = [](long long a, long long b) { return a * b % MOD; };
+ *   DisjointSparseTable<long long, decltype(mul)> dst(vec, mul);
+ *
+ * Level h splits the array into blocks of 2^h; inside each block it stores the combine
+ * from every position up to the block middle (left half) and from the middle to every
+ * position (right half). A query [l, r] with l != r uses the level where l and r first
+ * fall on different sides of a middle: exactly ONE combine.
+ *
+ * COMPLEXITY:
+ *   Build: O(N log N) time, O(N log N) space.
+ *   Query: O(1) time, one call to the function.
+ */
+
+#include <bits/stdc++.h>
+using namespace std;
+
+template<typename T, typename F = function<T(T, T)>>
+struct DisjointSparseTable {
+    int n, levels;
+    vector<T> table; // level h occupies [h * n, (h + 1) * n)
+    F func;
+
+    DisjointSparseTable(const vector<T>& a, F f = [](T x, T y) { return x + y; })
+        : n(a.size()), func(f) {
+        levels = 1;
+        while ((1 << (levels - 1)) < n) levels++;
+        table.resize((size_t)levels * n);
+        for (int i = 0; i < n; i++) table[i] = a[i];
+
+        for (int h = 1; h < levels; h++) {
+            T* row = table.data() + (size_t)h * n;
+            int half = 1 << (h - 1);
+            for (int mid = half; mid < n; mid += 2 * half) {
+                row[mid - 1] = a[mid - 1];
+                for (int i = mid - 2; i >= mid - half; i--) row[i] = func(a[i], row[i + 1]);
+                row[mid] = a[mid];
+                for (int i = mid + 1; i < min(n, mid + half); i++) row[i] = func(row[i - 1], a[i]);
+            }
+        }
+    }
+
+    T query(int l, int r) {
+        if (l == r) return table[l];
+        int h = 32 - __builtin_clz(l ^ r);
+        const T* row = table.data() + (size_t)h * n;
+        return func(row[l], row[r]);
+    }
+};
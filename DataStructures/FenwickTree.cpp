@@ -0,0 +1,139 @@
+/**
+ * FENWICK TREE (Binary Indexed Tree) FAMILY
+ * -----------------------------------------
+ * Prefix / range sums (operator += and binary -) in n words instead of the 4n of a Segment Tree.
+ * All indices are 0-based.
+ *
+ * USAGE:
+ *   FenwickTree<long long> bit(n);      // all zeros
+ *   FenwickTree<long long> bit(vec);    // O(N) build
+ *     bit.add(i, x)          : a[i] += x
+ *     bit.prefix(i)          : a[0] + ... + a[i]  (0 if i < 0)
+ *     bit.query(l, r)        : a[l] + ... + a[r]
+ *     bit.lower_bound(s)     : smallest i with prefix(i) >= s (n if none). Needs a[i] >= 0.
+ *
+ *   RangeFenwick<long long> rb(n);      // or rb(vec)
+ *     rb.add(l, r, x)        : a[i] += x for i in [l, r]
+ *     rb.query(l, r)         : a[l] + ... + a[r]
+ *
+ *   Fenwick2D<long long> b2(rows, cols);
+ *     b2.add(r, c, x)                : a[r][c] += x
+ *     b2.prefix(r, c)                : sum of a[0..r][0..c]
+ *     b2.query(r1, c1, r2, c2)       : sum of the rectangle [r1..r2] x [c1..c2]
+ *
+ * COMPLEXITY:
+ *   Build: O(N). Update / Query / lower_bound: O(log N). 2D: O(log R * log C).
+ *   Space: N (1D), 2N (range), R * C (2D).
+ */
+
+#include <bits/stdc++.h>
+using namespace std;
+
+template<typename T>
+struct FenwickTree {
+    int n;
+    vector<T> bit;
+
+    FenwickTree(int n) : n(n), bit(n + 1, T()) {}
+
+    FenwickTree(const vector<T>& a) : n(a.size()), bit(a.size() + 1, T()) {
+        for (int i = 1; i <= n; i++) {
+            bit[i] += a[i - 1];
+            int j = i + (i & -i);
+            if (j <= n) bit[j] += bit[i];
+        }
+    }
+
+    void add(int i, T x) {
+        for (i++; i <= n; i += i & -i) bit[i] += x;
+    }
+
+    T prefix(int i) const {
+        T res = T();
+        for (i++; i > 0; i -= i & -i) res += bit[i];
+        return res;
+    }
+
+    T query(int l, int r) const {
+        if (l > r) return T();
+        return prefix(r) - prefix(l - 1);
+    }
+
+    int lower_bound(T s) const {
+        if (s <= T()) return 0;
+        int pos = 0;
+        for (int pw = 1 << (31 - __builtin_clz(max(n, 1))); pw > 0; pw >>= 1) {
+            if (pos + pw <= n && bit[pos + pw] < s) {
+                pos += pw;
+                s -= bit[pos];
+            }
+        }
+        return pos;
+    }
+};
+
+template<typename T>
+struct RangeFenwick {
+    int n;
+    FenwickTree<T> b1, b2;
+
+    RangeFenwick(int n) : n(n), b1(n), b2(n) {}
+
+    RangeFenwick(const vector<T>& a) : n(a.size()), b1(a.size()), b2(a.size()) {
+        // Start from the difference array d[i] = a[i] - a[i - 1]
+        vector<T> d(n), di(n);
+        for (int i = 0; i < n; i++) {
+            d[i] = a[i] - (i ? a[i - 1] : T());
+            di[i] = d[i] * (T)i;
+        }
+        b1 = FenwickTree<T>(d);
+        b2 = FenwickTree<T>(di);
+    }
+
+    void add(int l, int r, T x) {
+        b1.add(l, x);
+        b2.add(l, x * (T)l);
+        if (r + 1 < n) {
+            b1.add(r + 1, -x);
+            b2.add(r + 1, -x * (T)(r + 1));
+        }
+    }
+
+    // a[0] + ... + a[i]
+    T prefix(int i) const {
+        if (i < 0) return T();
+        return b1.prefix(i) * (T)(i + 1) - b2.prefix(i);
+    }
+
+    T query(int l, int r) const {
+        if (l > r) return T();
+        return prefix(r) - prefix(l - 1);
+    }
+};
+
+template<typename T>
+struct Fenwick2D {
+    int R, C;
+    vector<vector<T>> bit;
+
+    Fenwick2D(int r, int c) : R(r), C(c), bit(r + 1, vector<T>(c + 1, T())) {}
+
+    void add(int r, int c, T x) {
+        for (int i = r + 1; i <= R; i += i & -i)
+            for (int j = c + 1; j <= C; j += j & -j)
+                bit[i][j] += x;
+    }
+
+    T prefix(int r, int c) const {
+        T res = T();
+        for (int i = r + 1; i > 0; i -= i & -i)
+            for (int j = c + 1; j > 0; j -= j & -j)
+                res += bit[i][j];
+        return res;
+    }
+
+    T query(int r1, int c1, int r2, int c2) const {
+        if (r1 > r2 || c1 > c2) return T();
+        return prefix(r2, c2) - prefix(r1 - 1, c2) - prefix(r2, c1 - 1) + prefix(r1 - 1, c1 - 1);
+    }
+};
@@ -0,0 +1,78 @@
+/**
+ * LINEAR RMQ (Block bitmask + Sparse Table over blocks)
+ * ------------------------------------------------------
+ * Static Range MINIMUM Queries in O(1) with O(N) memory.
+ * Drop-in for SparseTable<T> when only min is needed and N log N values do not fit.
+ *
+ * USAGE:
+ *   LinearRMQ<int> rmq(vec);
+ *   LinearRMQ<int> rmq(move(vec)); // takes the array without copying, read it as rmq.a
+ *   rmq.query(l, r)   : min of a[l..r]
+ *   rmq.bytes()       : memory used by the structure
+ *
+ * The array is cut into blocks of 32. Inside a block, mask[i] is the monotonic stack
+ * of minimum candidates ending at i as a bitmask, so an in-block query is one
+ * ctz. Whole blocks are answered by a Sparse Table over the N / 32 block minima.
+ *
+ * COMPLEXITY:
+ *   Build: O(N) time.
+ *   Query: O(1) time.
+ *   Space: N values + N 32-bit masks + (N / 32) log N values (~ 8 + 4 log2(N) / 32 bytes
+ *          per element for int, vs 4 log2(N) for SparseTable).
+ */
+
+#include <bits/stdc++.h>
+using namespace std;
+
+template<typename T>
+struct LinearRMQ {
+    static const int B = 32;
+    int n = 0, nb = 0;
+    vector<T> a, table; // table: level j occupies [j * nb, (j + 1) * nb)
+    vector<uint32_t> mask;
+
+    LinearRMQ() {}
+    LinearRMQ(vector<T> v) : n(v.size()), a(move(v)), mask(n) {
+        if (n == 0) return;
+        nb = (n + B - 1) / B;
+        int levels = 32 - __builtin_clz(nb);
+        table.resize((size_t)levels * nb);
+
+        for (int b = 0; b < nb; b++) {
+            int s = b * B, e = min(n, s + B);
+            uint32_t cur = 0;
+            for (int i = s; i < e; i++) {
+                while (cur && a[s + 31 - __builtin_clz(cur)] >= a[i]) cur ^= 1u << (31 - __builtin_clz(cur));
+                cur |= 1u << (i - s);
+                mask[i] = cur;
+            }
+            table[b] = a[s + __builtin_ctz(cur)];
+        }
+        for (int j = 1; j < levels; j++) {
+            T* row = table.data() + (size_t)j * nb;
+            const T* prev = row - nb;
+            for (int i = 0; i + (1 << j) <= nb; i++) row[i] = min(prev[i], prev[i + (1 << (j - 1))]);
+        }
+    }
+
+    // l and r in the same block
+    T small(int l, int r) const {
+        return a[l + __builtin_ctz(mask[r] >> (l % B))];
+    }
+
+    T query(int l, int r) const {
+        int bl = l / B, br = r / B;
+        if (bl == br) return small(l, r);
+        T res = min(small(l, bl * B + B - 1), small(br * B, r));
+        if (bl + 1 < br) {
+            int k = 31 - __builtin_clz(br - bl - 1);
+            const T* row = table.data() + (size_t)k * nb;
+            res = min(res, min(row[bl + 1], row[br - (1 << k)]));
+        }
+        return res;
+    }
+
+    size_t bytes() const {
+        return a.size() * sizeof(T) + table.size() * sizeof(T) + mask.size() * sizeof(uint32_t);
+    }
+};
@@ -0,0 +1,145 @@
+/**
+ * WAVELET MATRIX
+ * --------------
+ * Static order-statistics on ranges: k-th smallest, rank (count of x), count in value range.
+ * Values must be NON-NEGATIVE integers (coordinate-compress first if they are negative or huge).
+ *
+ * USAGE:
+ *   WaveletMatrix<int> wm(vec);
+ *   wm.access(i)              : a[i]
+ *   wm.kth(l, r, k)           : k-th smallest (0-indexed) value in a[l..r]
+ *   wm.rank(x, l, r)          : occurrences of x in a[l..r]
+ *   wm.countLess(l, r, x)     : number of a[i] < x in a[l..r]
+ *   wm.range_freq(l, r, lo, hi) : number of a[i] with lo <= a[i] < hi in a[l..r]
+ *
+ * Each level is a bit vector (64-bit words) with one cumulative count per 256 bits,
+ * so rank is a lookup plus at most 4 popcounts.
+ *
+ * COMPLEXITY:
+ *   Build: O(N log S) time, ~1.125 N log S bits of space (S = max value + 1).
+ *   Query: O(log S) time.
+ */
+
+#include <bits/stdc++.h>
+using namespace std;
+
+struct BitVector {
+    vector<uint64_t> words;
+    vector<int> block; // ones before each 256-bit block
+
+    BitVector(int n = 0) : words((n >> 6) + 1, 0) {}
+
+    void set(int i) { words[i >> 6] |= 1ULL << (i & 63); }
+
+    void build() {
+        block.assign((words.size() >> 2) + 1, 0);
+        int cnt = 0;
+        for (int i = 0; i < (int)words.size(); i++) {
+            if ((i & 3) == 0) block[i >> 2] = cnt;
+            cnt += __builtin_popcountll(words[i]);
+        }
+    }
+
+    // Number of ones in positions [0, i)
+    int rank1(int i) const {
+        int w = i >> 6;
+        int res = block[w >> 2];
+        for (int j = w & ~3; j < w; j++) res += __builtin_popcountll(words[j]);
+        return res + __builtin_popcountll(words[w] & ((1ULL << (i & 63)) - 1));
+    }
+    int rank0(int i) const { return i - rank1(i); }
+};
+
+template<typename T>
+struct WaveletMatrix {
+    static const int BITS = sizeof(T) * 8 - 1;
+    int n, LOG;
+    vector<BitVector> levels;
+    vector<int> zeros;
+
+    WaveletMatrix(const vector<T>& a) : n(a.size()) {
+        T mx = 0;
+        for (T x : a) mx = max(mx, x);
+        LOG = 1;
+        while (LOG < BITS && ((T)1 << LOG) <= mx) LOG++;
+        levels.assign(LOG, BitVector(n));
+        zeros.assign(LOG, 0);
+
+        vector<T> cur(a), nxt(n);
+        for (int lev = LOG - 1; lev >= 0; lev--) {
+            int z = 0;
+            for (int i = 0; i < n; i++) {
+                if ((cur[i] >> lev) & 1) levels[lev].set(i);
+                else z++;
+            }
+            levels[lev].build();
+            zeros[lev] = z;
+            int p0 = 0, p1 = z;
+            for (int i = 0; i < n; i++) {
+                if ((cur[i] >> lev) & 1) nxt[p1++] = cur[i];
+                else nxt[p0++] = cur[i];
+            }
+            swap(cur, nxt);
+        }
+    }
+
+    T access(int i) const {
+        T res = 0;
+        for (int lev = LOG - 1; lev >= 0; lev--) {
+            const BitVector& b = levels[lev];
+            if ((b.words[i >> 6] >> (i & 63)) & 1) {
+                res |= (T)1 << lev;
+                i = zeros[lev] + b.rank1(i);
+            } else {
+                i = b.rank0(i);
+            }
+        }
+        return res;
+    }
+
+    T kth(int l, int r, int k) const {
+        r++;
+        T res = 0;
+        for (int lev = LOG - 1; lev >= 0; lev--) {
+            const BitVector& b = levels[lev];
+            int l0 = b.rank0(l), r0 = b.rank0(r);
+            if (k < r0 - l0) {
+                l = l0; r = r0;
+            } else {
+                k -= r0 - l0;
+                res |= (T)1 << lev;
+                l = zeros[lev] + (l - l0);
+                r = zeros[lev] + (r - r0);
+            }
+        }
+        return res;
+    }
+
+    int countLess(int l, int r, T x) const {
+        r++;
+        if (l >= r || x <= 0) return 0;
+        if (LOG < BITS && x >= ((T)1 << LOG)) return r - l;
+        int res = 0;
+        for (int lev = LOG - 1; lev >= 0; lev--) {
+            const BitVector& b = levels[lev];
+            int l0 = b.rank0(l), r0 = b.rank0(r);
+            if ((x >> lev) & 1) {
+                res += r0 - l0;
+                l = zeros[lev] + (l - l0);
+                r = zeros[lev] + (r - r0);
+            } else {
+                l = l0; r = r0;
+            }
+        }
+        return res;
+    }
+
+    int rank(T x, int l, int r) const {
+        return countLess(l, r, x + 1) - countLess(l, r, x);
+    }
+
+    int range_freq(int l, int r, T lo, T hi) const {
+        if (lo >= hi) return 0;
+        return countLess(l, r, hi) - countLess(l, r, lo);
+    }
+};
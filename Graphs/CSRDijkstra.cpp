@@ -0,0 +1,336 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+typedef long long ll;
+
+const ll DIST_INF = 1e18; // same sentinel as INF in Dijkstra.cpp
+
+/*
+ * CSR DIJKSTRA - Single source shortest paths over a compressed sparse row graph
+ *
+ * CSRGraph:
+ *   CSRGraph(n, edges) - edges = {{u, v, w}, ...} directed, 0 <= w < 2^32
+ *   CSRGraph(adj)      - From the adjacency list format of Dijkstra.cpp (adj[u] = {{v, w}}),
+ *                        same limit 0 <= w < 2^32 (asserted: weights are stored in 32 bits)
+ *   Arcs of u are arc[off[u] .. off[u + 1] - 1], each {to, w} packed in 8 bytes
+ *   (at most 2^32 - 1 edges)
+ *
+ * Heaps (template argument of dijkstra):
+ *   QuaternaryHeap - Indexed 4-ary heap with decrease-key: at most V entries
+ *   RadixHeap      - Monotone radix heap on 64-bit keys: amortized O(log C) per pop,
+ *                    where C is the largest distance; duplicates are skipped when popped
+ *
+ * dijkstra<Heap = QuaternaryHeap>(g, src, dist, parent)
+ *   Result: dist[i] = shortest distance from src to i (DIST_INF if unreachable)
+ *           parent[i] = previous node in shortest path (-1 if none)
+ *   dist / parent are vector<long long> with the same sentinels as Dijkstra.cpp, so
+ *   getPath(dest, parent, dist) works on them unchanged.
+ *
+ * Time: O((V + E) log V) with QuaternaryHeap, O(E + V log C) with RadixHeap
+ */
+
+struct CSRGraph {
+    struct Arc { uint32_t to, w; };
+    int n;
+    vector<uint32_t> off;
+    vector<Arc> arc;
+
+    CSRGraph(int n, const vector<tuple<int, int, uint32_t>>& edges) : n(n), off(n + 1, 0), arc(edges.size()) {
+        for (auto& [u, v, w] : edges) off[u + 1]++;
+        for (int i = 0; i < n; i++) off[i + 1] += off[i];
+        vector<uint32_t> fill(off.begin(), off.end() - 1);
+        for (auto& [u, v, w] : edges) arc[fill[u]++] = {(uint32_t)v, w};
+    }
+
+    CSRGraph(int n = 0) : n(n), off(n + 1, 0) {}
+
+    CSRGraph(const vector<vector<pair<ll, ll>>>& adj) : n(adj.size()), off(adj.size() + 1, 0) {
+        for (int u = 0; u < n; u++) off[u + 1] = off[u] + adj[u].size();
+        arc.reserve(off[n]);
+        for (int u = 0; u < n; u++)
+            for (auto [v, w] : adj[u]) {
+                assert(0 <= w && w <= (ll)UINT32_MAX);
+                arc.push_back({(uint32_t)v, (uint32_t)w});
+            }
+    }
+
+    // Same vertices with every arc u -> v turned into v -> u
+    CSRGraph reversed() const {
+        CSRGraph r(n);
+        r.arc.resize(arc.size());
+        for (auto& a : arc) r.off[a.to + 1]++;
+        for (int i = 0; i < n; i++) r.off[i + 1] += r.off[i];
+        vector<uint32_t> fill(r.off.begin(), r.off.end() - 1);
+        for (int u = 0; u < n; u++)
+            for (uint32_t i = off[u]; i < off[u + 1]; i++) r.arc[fill[arc[i].to]++] = {(uint32_t)u, arc[i].w};
+        return r;
+    }
+};
+
+struct QuaternaryHeap {
+    struct Item { ll key; int v; };
+    vector<Item> heap;
+    vector<int> pos; // index in heap, -1 if absent
+
+    void init(int n) {
+        heap.clear();
+        pos.assign(n, -1);
+    }
+
+    bool empty() const { return heap.empty(); }
+
+    // Empty the heap in O(size) instead of O(n)
+    void clear() {
+        for (auto& x : heap) pos[x.v] = -1;
+        heap.clear();
+    }
+
+    ll topKey() const { return heap[0].key; }
+
+    void siftUp(int i) {
+        Item x = heap[i];
+        while (i > 0) {
+            int p = (i - 1) >> 2;
+            if (heap[p].key <= x.key) break;
+            heap[i] = heap[p];
+            pos[heap[i].v] = i;
+            i = p;
+        }
+        heap[i] = x;
+        pos[x.v] = i;
+    }
+
+    void siftDown(int i) {
+        Item x = heap[i];
+        int sz = heap.size();
+        while (true) {
+            int c = 4 * i + 1;
+            if (c >= sz) break;
+            int best = c, e = min(c + 4, sz);
+            for (int j = c + 1; j < e; j++)
+                if (heap[j].key < heap[best].key) best = j;
+            if (heap[best].key >= x.key) break;
+            heap[i] = heap[best];
+            pos[heap[i].v] = i;
+            i = best;
+        }
+        heap[i] = x;
+        pos[x.v] = i;
+    }
+
+    // Insert v, or decrease its key
+    void push(int v, ll key) {
+        if (pos[v] < 0) {
+            pos[v] = heap.size();
+            heap.push_back({key, v});
+        } else {
+            heap[pos[v]].key = key;
+        }
+        siftUp(pos[v]);
+    }
+
+    pair<ll, int> pop() {
+        Item top = heap[0];
+        pos[top.v] = -1;
+        Item last = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            heap[0] = last;
+            siftDown(0);
+        }
+        return {top.key, top.v};
+    }
+};
+
+struct RadixHeap {
+    vector<pair<uint64_t, int>> bucket[65];
+    uint64_t last = 0;
+    size_t sz = 0;
+
+    void init(int) {
+        for (auto& b : bucket) b.clear();
+        last = 0;
+        sz = 0;
+    }
+
+    bool empty() const { return sz == 0; }
+
+    static int index(uint64_t x) { return x ? 64 - __builtin_clzll(x) : 0; }
+
+    // Keys must be >= the last popped key
+    void push(int v, ll key) {
+        bucket[index(key ^ last)].push_back({(uint64_t)key, v});
+        sz++;
+    }
+
+    pair<ll, int> pop() {
+        if (bucket[0].empty()) {
+            int i = 1;
+            while (bucket[i].empty()) i++;
+            last = min_element(bucket[i].begin(), bucket[i].end())->first;
+            for (auto& x : bucket[i]) bucket[index(x.first ^ last)].push_back(x);
+            bucket[i].clear();
+        }
+        auto x = bucket[0].back();
+        bucket[0].pop_back();
+        sz--;
+        return {(ll)x.first, x.second};
+    }
+};
+
+template<class Heap = QuaternaryHeap>
+void dijkstra(const CSRGraph& g, int src, vector<ll>& dist, vector<ll>& parent) {
+    dist.assign(g.n, DIST_INF);
+    parent.assign(g.n, -1);
+    Heap pq;
+    pq.init(g.n);
+    dist[src] = 0;
+    pq.push(src, 0);
+    const CSRGraph::Arc* arc = g.arc.data();
+
+    while (!pq.empty()) {
+        auto [d, u] = pq.pop();
+        if (d > dist[u]) continue;
+
+        for (uint32_t i = g.off[u], e = g.off[u + 1]; i < e; i++) {
+            int v = arc[i].to;
+            ll nd = d + arc[i].w;
+            if (nd < dist[v]) {
+                dist[v] = nd;
+                parent[v] = u;
+                pq.push(v, nd);
+            }
+        }
+    }
+}
+
+/*
+ * POINT TO POINT QUERIES - Many s -> t shortest path queries on one fixed CSRGraph
+ *
+ * Constructor:
+ *   PointToPoint(g) - Keeps a reference to g; buffers are allocated once
+ *
+ * Functions (each returns the distance, DIST_INF if t is unreachable):
+ *   dijkstra(s, t)      - Plain Dijkstra, stops as soon as t is settled
+ *   bidirectional(s, t) - Searches from s on g and from t on the reversed graph (built on
+ *                         first use), stops when topForward + topBackward >= best
+ *   astar(s, t, h)      - A* with heuristic h(v) <= true distance from v to t (admissible)
+ *   path()              - Vertices of the last query's path s..t (empty if unreachable),
+ *                         same format as getPath
+ *
+ * Distances live in per-vertex arrays tagged with a query stamp: a vertex whose stamp is
+ * old counts as unvisited, so starting a query is O(1) and the heaps are emptied in
+ * O(entries left). A query costs only the vertices it touches.
+ *
+ * Time: O(touched * log V) per query
+ */
+
+struct PointToPoint {
+    struct Side {
+        vector<ll> dist;
+        vector<int> parent;
+        vector<uint32_t> stamp;
+        QuaternaryHeap pq;
+    };
+
+    const CSRGraph& g;
+    CSRGraph rev;
+    bool hasRev = false;
+    Side side[2]; // 0 = from s on g, 1 = from t on rev
+    uint32_t cur = 0;
+    int src = -1, dst = -1, meet = -1;
+
+    PointToPoint(const CSRGraph& g) : g(g) {
+        for (auto& sd : side) {
+            sd.dist.assign(g.n, DIST_INF);
+            sd.parent.assign(g.n, -1);
+            sd.stamp.assign(g.n, 0);
+            sd.pq.init(g.n);
+        }
+    }
+
+    ll get(int k, int v) const { return side[k].stamp[v] == cur ? side[k].dist[v] : DIST_INF; }
+
+    void set(int k, int v, ll d, int p) {
+        side[k].stamp[v] = cur;
+        side[k].dist[v] = d;
+        side[k].parent[v] = p;
+    }
+
+    void start(int s, int t) {
+        if (++cur == 0) { // stamp wrapped: clear once every 2^32 queries
+            for (auto& sd : side) fill(sd.stamp.begin(), sd.stamp.end(), 0);
+            cur = 1;
+        }
+        for (auto& sd : side) sd.pq.clear();
+        src = s; dst = t; meet = -1;
+    }
+
+    ll dijkstra(int s, int t) {
+        return astar(s, t, [](int) { return 0LL; });
+    }
+
+    template<class H>
+    ll astar(int s, int t, H&& h) {
+        start(s, t);
+        QuaternaryHeap& pq = side[0].pq;
+        set(0, s, 0, -1);
+        pq.push(s, h(s));
+        while (!pq.empty()) {
+            int u = pq.pop().second;
+            ll du = side[0].dist[u];
+            if (u == t) { meet = t; return du; }
+            for (uint32_t i = g.off[u], e = g.off[u + 1]; i < e; i++) {
+                int v = g.arc[i].to;
+                ll nd = du + g.arc[i].w;
+                if (nd < get(0, v)) {
+                    set(0, v, nd, u);
+                    pq.push(v, nd + h(v));
+                }
+            }
+        }
+        return DIST_INF;
+    }
+
+    ll bidirectional(int s, int t) {
+        if (!hasRev) { rev = g.reversed(); hasRev = true; }
+        start(s, t);
+        set(0, s, 0, -1);
+        set(1, t, 0, -1);
+        side[0].pq.push(s, 0);
+        side[1].pq.push(t, 0);
+        ll best = s == t ? 0 : DIST_INF;
+        if (s == t) meet = s;
+        while (!side[0].pq.empty() && !side[1].pq.empty()) {
+            if (side[0].pq.topKey() + side[1].pq.topKey() >= best) break;
+            int k = side[0].pq.heap.size() <= side[1].pq.heap.size() ? 0 : 1;
+            const CSRGraph& gr = k ? rev : g;
+            auto [du, u] = side[k].pq.pop();
+            for (uint32_t i = gr.off[u], e = gr.off[u + 1]; i < e; i++) {
+                int v = gr.arc[i].to;
+                ll nd = du + gr.arc[i].w;
+                if (nd < get(k, v)) {
+                    set(k, v, nd, u);
+                    side[k].pq.push(v, nd);
+                }
+                ll other = get(k ^ 1, v);
+                if (other != DIST_INF && nd + other < best) {
+                    best = nd + other;
+                    meet = v;
+                }
+            }
+        }
+        return best;
+    }
+
+    vector<ll> path() const {
+        vector<ll> p;
+        if (meet < 0) return p;
+        for (int v = meet; v != -1; v = side[0].parent[v]) p.push_back(v);
+        reverse(p.begin(), p.end());
+        // Backward half exists only after bidirectional(): parents there point towards t
+        if (side[1].stamp[meet] == cur)
+            for (int v = side[1].parent[meet]; v != -1; v = side[1].parent[v]) p.push_back(v);
+        return p;
+    }
+};
@@ -0,0 +1,166 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+typedef long long ll;
+
+/*
+ * MINIMUM SPANNING TREE / FOREST - Kruskal (radix sort) and parallel Boruvka
+ *
+ * Arguments:
+ *   n        - Number of nodes in the graph (0-indexed)
+ *   edges    - Undirected edges {u, v, w}
+ *   threads  - (boruvka only) number of worker threads
+ *
+ * Result: MSTResult { weight, edges } where edges holds the indices (into the input
+ *         vector) of the chosen edges. On a disconnected graph it is a spanning forest.
+ *
+ * kruskal(n, edges)            - Sequential. Edge order comes from an LSD radix sort of
+ *                                the weights (16-bit digits, constant digits skipped).
+ * boruvka(n, edges, threads)   - Each round, threads scan shards of the live edges and
+ *                                CAS the cheapest outgoing edge of every component;
+ *                                components are then contracted through a lock-free
+ *                                union-find and internal edges dropped. Compile with -pthread.
+ *
+ * Ties are broken by edge index, so both return the same tree.
+ *
+ * Time: kruskal O(E * d + E α(V)) with d <= 4 radix passes,
+ *       boruvka O(log V) rounds of O(E / threads + V / threads) each
+ */
+
+struct Edge { int u, v; ll w; };
+
+struct MSTResult {
+    ll weight = 0;
+    vector<int> edges;
+};
+
+// Stable order of edge indices by weight
+vector<int> radixOrder(const vector<Edge>& edges) {
+    int m = edges.size();
+    vector<uint64_t> key(m);
+    uint64_t diff = 0;
+    for (int i = 0; i < m; i++) {
+        key[i] = (uint64_t)edges[i].w ^ (1ULL << 63); // signed -> unsigned order
+        diff |= key[i] ^ key[0];
+    }
+    vector<int> ord(m), tmp(m);
+    iota(ord.begin(), ord.end(), 0);
+    for (int shift = 0; shift < 64; shift += 16) {
+        if (((diff >> shift) & 0xFFFF) == 0) continue;
+        vector<int> cnt(1 << 16 | 1, 0);
+        for (int i = 0; i < m; i++) cnt[((key[i] >> shift) & 0xFFFF) + 1]++;
+        for (int d = 0; d < (1 << 16); d++) cnt[d + 1] += cnt[d];
+        for (int i = 0; i < m; i++) tmp[cnt[(key[ord[i]] >> shift) & 0xFFFF]++] = ord[i];
+        swap(ord, tmp);
+    }
+    return ord;
+}
+
+MSTResult kruskal(int n, const vector<Edge>& edges) {
+    vector<int> p(n, -1); // parent, or -size for roots
+    auto find = [&](int a) {
+        while (p[a] >= 0) {
+            if (p[p[a]] >= 0) p[a] = p[p[a]];
+            a = p[a];
+        }
+        return a;
+    };
+    MSTResult res;
+    for (int id : radixOrder(edges)) {
+        int a = find(edges[id].u), b = find(edges[id].v);
+        if (a == b) continue;
+        if (p[a] > p[b]) swap(a, b);
+        p[a] += p[b];
+        p[b] = a;
+        res.weight += edges[id].w;
+        res.edges.push_back(id);
+        if ((int)res.edges.size() == n - 1) break;
+    }
+    return res;
+}
+
+MSTResult boruvka(int n, const vector<Edge>& edges, int threads = thread::hardware_concurrency()) {
+    threads = max(1, threads);
+    const uint32_t NONE = UINT32_MAX;
+    vector<atomic<int>> parent(n);
+    vector<atomic<uint32_t>> best(n);
+    for (int i = 0; i < n; i++) parent[i].store(i, memory_order_relaxed);
+
+    auto find = [&](int a) {
+        while (true) {
+            int p = parent[a].load(memory_order_acquire);
+            if (p == a) return a;
+            int gp = parent[p].load(memory_order_acquire);
+            if (p != gp) parent[a].compare_exchange_weak(p, gp, memory_order_release, memory_order_relaxed);
+            a = gp;
+        }
+    };
+    auto unite = [&](int a, int b) {
+        while (true) {
+            a = find(a); b = find(b);
+            if (a == b) return false;
+            if (a < b) swap(a, b);
+            int expected = a;
+            if (parent[a].compare_exchange_strong(expected, b, memory_order_acq_rel)) return true;
+        }
+    };
+    auto better = [&](uint32_t x, uint32_t y) {
+        return y == NONE || edges[x].w < edges[y].w || (edges[x].w == edges[y].w && x < y);
+    };
+    auto offer = [&](int root, uint32_t e) {
+        uint32_t cur = best[root].load(memory_order_relaxed);
+        while (better(e, cur) && !best[root].compare_exchange_weak(cur, e, memory_order_relaxed)) {}
+    };
+    auto parallelFor = [&](size_t count, auto&& f) {
+        vector<thread> pool;
+        size_t chunk = (count + threads - 1) / threads;
+        for (int t = 0; t < threads; t++) {
+            size_t lo = t * chunk, hi = min(count, lo + chunk);
+            if (lo >= hi) break;
+            pool.emplace_back([&f, lo, hi, t] { f(lo, hi, t); });
+        }
+        for (auto& th : pool) th.join();
+    };
+
+    vector<uint32_t> live(edges.size());
+    iota(live.begin(), live.end(), 0);
+    vector<vector<uint32_t>> keep(threads), chosen(threads);
+    MSTResult res;
+
+    while (!live.empty()) {
+        for (int t = 0; t < threads; t++) { keep[t].clear(); chosen[t].clear(); }
+        parallelFor(n, [&](size_t lo, size_t hi, int) {
+            for (size_t i = lo; i < hi; i++) best[i].store(NONE, memory_order_relaxed);
+        });
+        // Cheapest outgoing edge per component, dropping edges that became internal
+        parallelFor(live.size(), [&](size_t lo, size_t hi, int t) {
+            for (size_t i = lo; i < hi; i++) {
+                uint32_t e = live[i];
+                int a = find(edges[e].u), b = find(edges[e].v);
+                if (a == b) continue;
+                keep[t].push_back(e);
+                offer(a, e);
+                offer(b, e);
+            }
+        });
+        // Contract along the chosen edges
+        bool merged = false;
+        parallelFor(n, [&](size_t lo, size_t hi, int t) {
+            for (size_t i = lo; i < hi; i++) {
+                uint32_t e = best[i].load(memory_order_relaxed);
+                if (e != NONE && unite(edges[e].u, edges[e].v)) chosen[t].push_back(e);
+            }
+        });
+        live.clear();
+        for (int t = 0; t < threads; t++) {
+            live.insert(live.end(), keep[t].begin(), keep[t].end());
+            for (uint32_t e : chosen[t]) {
+                res.weight += edges[e].w;
+                res.edges.push_back(e);
+                merged = true;
+            }
+        }
+        if (!merged) break;
+    }
+    return res;
+}
@@ -0,0 +1,200 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+#define int long long
+
+typedef vector<int> vi;
+
+/*
+ * SEGMENT TREE BEATS (Ji Ruyi) - Range chmin / chmax / add and range sum
+ *
+ * Constructor:
+ *   SegmentTreeBeats(n) - Creates tree for n elements
+ *
+ * Functions:
+ *   build(a)          - Initialize tree with array a (0-indexed)
+ *   chmin(l, r, x)    - a[i] = min(a[i], x) for all i in [l, r]
+ *   chmax(l, r, x)    - a[i] = max(a[i], x) for all i in [l, r]
+ *   update(l, r, add) - Add 'add' to all elements in range [l, r]
+ *   query(l, r)       - Return sum of elements in range [l, r]
+ *   queryMax(l, r)    - Return max of elements in range [l, r]
+ *   queryMin(l, r)    - Return min of elements in range [l, r]
+ *
+ * Each node keeps max, second max, max count, min, second min, min count, sum
+ * and a pending add. chmin only descends while x <= second max (chmax symmetric).
+ *
+ * Time: O(log^2 n) amortized per operation (O(log n) for queries)
+ */
+
+struct SegmentTreeBeats {
+    static const int NONE = LLONG_MAX;
+
+    struct Node {
+        int mx1, mx2, mxc;
+        int mn1, mn2, mnc;
+        int sum, lazy;
+    };
+
+    int n;
+    vector<Node> tree;
+
+    SegmentTreeBeats(int n) : n(n) {
+        tree.assign(4 * n, {0, -NONE, 0, 0, NONE, 0, 0, 0});
+    }
+
+    void pull(int v) {
+        Node& t = tree[v];
+        const Node& a = tree[2 * v];
+        const Node& b = tree[2 * v + 1];
+        t.sum = a.sum + b.sum;
+
+        if (a.mx1 == b.mx1) {
+            t.mx1 = a.mx1; t.mxc = a.mxc + b.mxc;
+            t.mx2 = max(a.mx2, b.mx2);
+        } else if (a.mx1 > b.mx1) {
+            t.mx1 = a.mx1; t.mxc = a.mxc;
+            t.mx2 = max(a.mx2, b.mx1);
+        } else {
+            t.mx1 = b.mx1; t.mxc = b.mxc;
+            t.mx2 = max(a.mx1, b.mx2);
+        }
+
+        if (a.mn1 == b.mn1) {
+            t.mn1 = a.mn1; t.mnc = a.mnc + b.mnc;
+            t.mn2 = min(a.mn2, b.mn2);
+        } else if (a.mn1 < b.mn1) {
+            t.mn1 = a.mn1; t.mnc = a.mnc;
+            t.mn2 = min(a.mn2, b.mn1);
+        } else {
+            t.mn1 = b.mn1; t.mnc = b.mnc;
+            t.mn2 = min(a.mn1, b.mn2);
+        }
+    }
+
+    void applyAdd(int v, int tl, int tr, int add) {
+        Node& t = tree[v];
+        t.sum += add * (tr - tl + 1);
+        t.mx1 += add; t.mn1 += add;
+        if (t.mx2 != -NONE) t.mx2 += add;
+        if (t.mn2 != NONE) t.mn2 += add;
+        t.lazy += add;
+    }
+
+    // Lower the maximum to x, assuming mx2 < x < mx1
+    void applyMin(int v, int x) {
+        Node& t = tree[v];
+        t.sum += (x - t.mx1) * t.mxc;
+        if (t.mn1 == t.mx1) t.mn1 = x;
+        else if (t.mn2 == t.mx1) t.mn2 = x;
+        t.mx1 = x;
+    }
+
+    // Raise the minimum to x, assuming mn1 < x < mn2
+    void applyMax(int v, int x) {
+        Node& t = tree[v];
+        t.sum += (x - t.mn1) * t.mnc;
+        if (t.mx1 == t.mn1) t.mx1 = x;
+        else if (t.mx2 == t.mn1) t.mx2 = x;
+        t.mn1 = x;
+    }
+
+    void push(int v, int tl, int tr) {
+        if (tl == tr) return;
+        int tm = (tl + tr) / 2;
+        if (tree[v].lazy != 0) {
+            applyAdd(2 * v, tl, tm, tree[v].lazy);
+            applyAdd(2 * v + 1, tm + 1, tr, tree[v].lazy);
+            tree[v].lazy = 0;
+        }
+        for (int c = 2 * v; c <= 2 * v + 1; c++) {
+            if (tree[c].mx1 > tree[v].mx1) applyMin(c, tree[v].mx1);
+            if (tree[c].mn1 < tree[v].mn1) applyMax(c, tree[v].mn1);
+        }
+    }
+
+    void build(const vi& a, int v, int tl, int tr) {
+        tree[v].lazy = 0;
+        if (tl == tr) {
+            tree[v] = {a[tl], -NONE, 1, a[tl], NONE, 1, a[tl], 0};
+        } else {
+            int tm = (tl + tr) / 2;
+            build(a, 2 * v, tl, tm);
+            build(a, 2 * v + 1, tm + 1, tr);
+            pull(v);
+        }
+    }
+
+    void chmin(int v, int tl, int tr, int l, int r, int x) {
+        if (l > r || tree[v].mx1 <= x) return;
+        if (l == tl && r == tr && tree[v].mx2 < x) {
+            applyMin(v, x);
+            return;
+        }
+        push(v, tl, tr);
+        int tm = (tl + tr) / 2;
+        chmin(2 * v, tl, tm, l, min(r, tm), x);
+        chmin(2 * v + 1, tm + 1, tr, max(l, tm + 1), r, x);
+        pull(v);
+    }
+
+    void chmax(int v, int tl, int tr, int l, int r, int x) {
+        if (l > r || tree[v].mn1 >= x) return;
+        if (l == tl && r == tr && tree[v].mn2 > x) {
+            applyMax(v, x);
+            return;
+        }
+        push(v, tl, tr);
+        int tm = (tl + tr) / 2;
+        chmax(2 * v, tl, tm, l, min(r, tm), x);
+        chmax(2 * v + 1, tm + 1, tr, max(l, tm + 1), r, x);
+        pull(v);
+    }
+
+    void update(int v, int tl, int tr, int l, int r, int add) {
+        if (l > r) return;
+        if (l == tl && r == tr) {
+            applyAdd(v, tl, tr, add);
+            return;
+        }
+        push(v, tl, tr);
+        int tm = (tl + tr) / 2;
+        update(2 * v, tl, tm, l, min(r, tm), add);
+        update(2 * v + 1, tm + 1, tr, max(l, tm + 1), r, add);
+        pull(v);
+    }
+
+    int query(int v, int tl, int tr, int l, int r) {
+        if (l > r) return 0;
+        if (l == tl && r == tr) return tree[v].sum;
+        push(v, tl, tr);
+        int tm = (tl + tr) / 2;
+        return query(2 * v, tl, tm, l, min(r, tm))
+             + query(2 * v + 1, tm + 1, tr, max(l, tm + 1), r);
+    }
+
+    int queryMax(int v, int tl, int tr, int l, int r) {
+        if (l > r) return -NONE;
+        if (l == tl && r == tr) return tree[v].mx1;
+        push(v, tl, tr);
+        int tm = (tl + tr) / 2;
+        return max(queryMax(2 * v, tl, tm, l, min(r, tm)),
+                   queryMax(2 * v + 1, tm + 1, tr, max(l, tm + 1), r));
+    }
+
+    int queryMin(int v, int tl, int tr, int l, int r) {
+        if (l > r) return NONE;
+        if (l == tl && r == tr) return tree[v].mn1;
+        push(v, tl, tr);
+        int tm = (tl + tr) / 2;
+        return min(queryMin(2 * v, tl, tm, l, min(r, tm)),
+                   queryMin(2 * v + 1, tm + 1, tr, max(l, tm + 1), r));
+    }
+
+    void build(const vi& a) { build(a, 1, 0, n - 1); }
+    void chmin(int l, int r, int x) { chmin(1, 0, n - 1, l, r, x); }
+    void chmax(int l, int r, int x) { chmax(1, 0, n - 1, l, r, x); }
+    void update(int l, int r, int add) { update(1, 0, n - 1, l, r, add); }
+    int query(int l, int r) { return query(1, 0, n - 1, l, r); }
+    int queryMax(int l, int r) { return queryMax(1, 0, n - 1, l, r); }
+    int queryMin(int l, int r) { return queryMin(1, 0, n - 1, l, r); }
+};
@@ -0,0 +1,86 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+typedef long long ll;
+
+/*
+ * DYNAMIC SEGMENT TREE - Nodes created on demand over a huge coordinate range
+ *
+ * Constructor:
+ *   DynamicSegmentTree(maxCoord) - Tree over positions [0, maxCoord), all zeros (default 2^62)
+ *
+ * Functions:
+ *   reserve(k)        - Preallocate room for k nodes, so a known-size stream never reallocates
+ *   clear()           - Reset to all zeros, keeping the allocated pool for reuse
+ *   update(pos, val)  - Set element at position pos to val
+ *   add(l, r, x)      - Add x to all elements in range [l, r]
+ *   query(l, r)       - Return sum of elements in range [l, r]
+ *
+ * Range adds are kept on the node they land on (never pushed down), so queries
+ * and updates never allocate children that only hold a pending tag.
+ * Sums must fit in long long (x * length of the range).
+ *
+ * Time: O(log maxCoord) per operation
+ * Space: 24 bytes per node. A point update creates at most log2(maxCoord) + 1 nodes,
+ *        a range add at most 4 log2(maxCoord).
+ */
+
+struct DynamicSegmentTree {
+    struct Node {
+        ll sum, lazy;
+        uint32_t l, r;
+    };
+
+    ll maxCoord;
+    vector<Node> pool;
+
+    DynamicSegmentTree(ll maxCoord = 1LL << 62) : maxCoord(maxCoord) {
+        clear();
+    }
+
+    void reserve(size_t k) { pool.reserve(k + 2); }
+
+    void clear() {
+        pool.clear();
+        pool.push_back({0, 0, 0, 0}); // 0: null
+        pool.push_back({0, 0, 0, 0}); // 1: root
+    }
+
+    uint32_t newNode() {
+        pool.push_back({0, 0, 0, 0});
+        return pool.size() - 1;
+    }
+
+    void add(uint32_t v, ll tl, ll tr, ll l, ll r, ll x) {
+        if (l == tl && r == tr) {
+            pool[v].sum += x * (r - l + 1);
+            pool[v].lazy += x;
+            return;
+        }
+        pool[v].sum += x * (r - l + 1);
+        ll tm = tl + (tr - tl) / 2;
+        if (l <= tm) {
+            if (!pool[v].l) { uint32_t c = newNode(); pool[v].l = c; }
+            add(pool[v].l, tl, tm, l, min(r, tm), x);
+        }
+        if (r > tm) {
+            if (!pool[v].r) { uint32_t c = newNode(); pool[v].r = c; }
+            add(pool[v].r, tm + 1, tr, max(l, tm + 1), r, x);
+        }
+    }
+
+    ll query(uint32_t v, ll tl, ll tr, ll l, ll r) {
+        if (l > r || v == 0) return 0;
+        if (l == tl && r == tr) return pool[v].sum;
+        ll tm = tl + (tr - tl) / 2;
+        return pool[v].lazy * (r - l + 1)
+             + query(pool[v].l, tl, tm, l, min(r, tm))
+             + query(pool[v].r, tm + 1, tr, max(l, tm + 1), r);
+    }
+
+    void add(ll l, ll r, ll x) {
+        if (l <= r) add(1, 0, maxCoord - 1, l, r, x);
+    }
+    ll query(ll l, ll r) { return query(1, 0, maxCoord - 1, l, r); }
+    void update(ll pos, ll val) { add(pos, pos, val - query(pos, pos)); }
+};
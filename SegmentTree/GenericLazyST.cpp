@@ -0,0 +1,136 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+ * GENERIC LAZY SEGMENT TREE - Iterative, any monoid + any composable tag
+ *
+ * Template:
+ *   S, op, e                - Value monoid: S op(S a, S b), S e()
+ *   F, mapping, composition, id
+ *                           - Tag monoid acting on S:
+ *                             S mapping(F f, S x)       -> f applied to node value x
+ *                             F composition(F f, F g)   -> "apply g first, then f"
+ *                             F id()                    -> identity tag
+ *   mapping must work on e() (padding leaves), so keep segment length inside S
+ *   when the tag depends on it (e.g. assign/add on sums).
+ *
+ * Constructor:
+ *   GenericLazySegmentTree<S, op, e, F, mapping, composition, id>(n)
+ *
+ * Functions:
+ *   build(a)        - Initialize tree with array a (0-indexed) in O(n)
+ *   update(l, r, f) - Apply tag f to every element in range [l, r]
+ *   set(pos, x)     - Set element at position pos to x
+ *   get(pos)        - Return element at position pos
+ *   query(l, r)     - Return a[l] op ... op a[r] (e() if l > r)
+ *
+ * USAGE (range affine x -> b*x + c mod p, range sum):
+ *   struct S { long long sum, len; };
+ *   struct F { long long b, c; };
+ *   S op(S x, S y) { return {(x.sum + y.sum) % MOD, x.len + y.len}; }
+ *   S e() { return {0, 0}; }
+ *   S mapping(F f, S x) { return {(f.b * x.sum + f.c * x.len) % MOD, x.len}; }
+ *   F composition(F f, F g) { return {f.b * g.b % MOD, (f.b * g.c + f.c) % MOD}; }
+ *   F id() { return {1, 0}; }
+ *   GenericLazySegmentTree<S, op, e, F, mapping, composition, id> st(n);
+ *   st.build(vector<S>(n, {0, 1}));
+ *   Range assign x is {0, x}, range add x is {1, x}, so both mix on the same array.
+ *
+ * Time: O(log n) per operation, no recursion. Pushes are skipped on nodes with no pending tag.
+ * Space: 2 * (n rounded up to a power of two) nodes, value and tag stored together
+ */
+
+template<typename S, S (*op)(S, S), S (*e)(),
+         typename F, S (*mapping)(F, S), F (*composition)(F, F), F (*id)()>
+struct GenericLazySegmentTree {
+    struct Node {
+        S val;
+        F tag;
+        bool pending;
+    };
+
+    int n, size, log;
+    vector<Node> tree;
+
+    GenericLazySegmentTree(int n) : n(n) {
+        log = 0;
+        while ((1 << log) < n) log++;
+        size = 1 << log;
+        tree.assign(2 * size, {e(), id(), false});
+    }
+
+    void pull(int v) {
+        tree[v].val = op(tree[2 * v].val, tree[2 * v + 1].val);
+    }
+
+    void apply(int v, const F& f) {
+        tree[v].val = mapping(f, tree[v].val);
+        if (v < size) {
+            tree[v].tag = tree[v].pending ? composition(f, tree[v].tag) : f;
+            tree[v].pending = true;
+        }
+    }
+
+    void push(int v) {
+        if (!tree[v].pending) return;
+        apply(2 * v, tree[v].tag);
+        apply(2 * v + 1, tree[v].tag);
+        tree[v].tag = id();
+        tree[v].pending = false;
+    }
+
+    // Push every pending tag on the path from the root down to leaf p
+    void pushPath(int p) {
+        for (int i = log; i > 0; i--) push(p >> i);
+    }
+
+    void build(const vector<S>& a) {
+        for (int i = 0; i < n; i++) tree[size + i].val = a[i];
+        for (int i = size - 1; i > 0; i--) pull(i);
+    }
+
+    void set(int pos, S x) {
+        pos += size;
+        pushPath(pos);
+        tree[pos].val = x;
+        for (pos >>= 1; pos > 0; pos >>= 1) pull(pos);
+    }
+
+    S get(int pos) {
+        pos += size;
+        pushPath(pos);
+        return tree[pos].val;
+    }
+
+    S query(int l, int r) {
+        if (l > r) return e();
+        l += size; r += size + 1;
+        for (int i = log; i > 0; i--) {
+            if (((l >> i) << i) != l) push(l >> i);
+            if (((r >> i) << i) != r) push((r - 1) >> i);
+        }
+        S resl = e(), resr = e();
+        for (; l < r; l >>= 1, r >>= 1) {
+            if (l & 1) resl = op(resl, tree[l++].val);
+            if (r & 1) resr = op(tree[--r].val, resr);
+        }
+        return op(resl, resr);
+    }
+
+    void update(int l, int r, F f) {
+        if (l > r) return;
+        l += size; r += size + 1;
+        for (int i = log; i > 0; i--) {
+            if (((l >> i) << i) != l) push(l >> i);
+            if (((r >> i) << i) != r) push((r - 1) >> i);
+        }
+        for (int a = l, b = r; a < b; a >>= 1, b >>= 1) {
+            if (a & 1) apply(a++, f);
+            if (b & 1) apply(--b, f);
+        }
+        for (int i = 1; i <= log; i++) {
+            if (((l >> i) << i) != l) pull(l >> i);
+            if (((r >> i) << i) != r) pull((r - 1) >> i);
+        }
+    }
+};
@@ -0,0 +1,115 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+ * GENERIC SEGMENT TREE - Iterative (bottom-up), any monoid, point updates and range queries
+ *
+ * Template:
+ *   T     - Value type
+ *   op    - Associative combine: T op(T a, T b) (does NOT need to be commutative)
+ *   e     - Identity element:    T e()          (op(e(), x) == op(x, e()) == x)
+ *
+ * Constructor:
+ *   GenericSegmentTree<T, op, e>(n) - Creates tree for n elements, all equal to e()
+ *
+ * Functions:
+ *   build(a)         - Initialize tree with array a (0-indexed) in O(n)
+ *   update(pos, val) - Set element at position pos to val
+ *   get(pos)         - Return element at position pos in O(1)
+ *   query(l, r)      - Return a[l] op ... op a[r] (e() if l > r)
+ *   max_right(l, f)  - Largest r in [l - 1, n - 1] with f(query(l, r)) == true
+ *   min_left(r, f)   - Smallest l in [0, r + 1] with f(query(l, r)) == true
+ *                      (f must be monotone and f(e()) must be true)
+ *
+ * USAGE:
+ *   long long op(long long a, long long b) { return a + b; }
+ *   long long e() { return 0; }
+ *   GenericSegmentTree<long long, op, e> st(n);
+ *   st.build(a);
+ *   int r = st.max_right(0, [&](long long s) { return s <= X; }) + 1; // first prefix > X
+ *
+ * Time: O(log n) per operation (including max_right / min_left), O(n) build
+ * Space: 2n values, no recursion
+ */
+
+template<typename T, T (*op)(T, T), T (*e)()>
+struct GenericSegmentTree {
+    int n;
+    vector<T> tree;
+
+    GenericSegmentTree(int n) : n(n) {
+        tree.assign(2 * n, e());
+    }
+
+    void build(const vector<T>& a) {
+        for (int i = 0; i < n; i++) tree[n + i] = a[i];
+        for (int i = n - 1; i > 0; i--) tree[i] = op(tree[2 * i], tree[2 * i + 1]);
+    }
+
+    void update(int pos, T val) {
+        pos += n;
+        tree[pos] = val;
+        for (pos >>= 1; pos > 0; pos >>= 1) tree[pos] = op(tree[2 * pos], tree[2 * pos + 1]);
+    }
+
+    T get(int pos) const { return tree[pos + n]; }
+
+    T query(int l, int r) const {
+        T resl = e(), resr = e();
+        for (l += n, r += n + 1; l < r; l >>= 1, r >>= 1) {
+            if (l & 1) resl = op(resl, tree[l++]);
+            if (r & 1) resr = op(tree[--r], resr);
+        }
+        return op(resl, resr);
+    }
+
+    // Canonical nodes covering [l, r) listed from left to right
+    int nodes(int l, int r, int* out) const {
+        int left[64], right[64], nl = 0, nr = 0;
+        for (l += n, r += n; l < r; l >>= 1, r >>= 1) {
+            if (l & 1) left[nl++] = l++;
+            if (r & 1) right[nr++] = --r;
+        }
+        for (int i = 0; i < nl; i++) out[i] = left[i];
+        for (int i = nr - 1; i >= 0; i--) out[nl++] = right[i];
+        return nl;
+    }
+
+    template<typename F>
+    int max_right(int l, F f) const {
+        int v[128];
+        int cnt = nodes(l, n, v);
+        T acc = e();
+        for (int i = 0; i < cnt; i++) {
+            int x = v[i];
+            if (!f(op(acc, tree[x]))) {
+                while (x < n) {
+                    x = 2 * x;
+                    if (f(op(acc, tree[x]))) acc = op(acc, tree[x++]);
+                }
+                return x - n - 1;
+            }
+            acc = op(acc, tree[x]);
+        }
+        return n - 1;
+    }
+
+    template<typename F>
+    int min_left(int r, F f) const {
+        int v[128];
+        int cnt = nodes(0, r + 1, v);
+        T acc = e();
+        for (int i = cnt - 1; i >= 0; i--) {
+            int x = v[i];
+            if (!f(op(tree[x], acc))) {
+                while (x < n) {
+                    x = 2 * x + 1;
+                    if (f(op(tree[x], acc))) acc = op(tree[x--], acc);
+                }
+                return x - n + 1;
+            }
+            acc = op(tree[x], acc);
+        }
+        return 0;
+    }
+};
@@ -0,0 +1,122 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+typedef long long ll;
+typedef vector<ll> vll;
+
+/*
+ * PERSISTENT SEGMENT TREE - Path copying, every version stays queryable
+ *
+ * Constructor:
+ *   PersistentSegmentTree(n, maxUpdates) - Tree over positions [0, n). Version 0 is all zeros.
+ *                                          Preallocates the node pool for one build plus
+ *                                          maxUpdates point updates (grows if exceeded).
+ *
+ * Functions:
+ *   build(a)             - New version holding array a, returns its id
+ *   update(ver, pos, v)  - New version = ver with a[pos] = v, returns its id
+ *   add(ver, pos, d)     - New version = ver with a[pos] += d, returns its id
+ *   query(ver, l, r)     - Sum of a[l..r] in version ver
+ *   kth(verL, verR, k)   - Smallest p with sum of (verR - verL) over [0, p] >= k (k is 1-indexed)
+ *   nodesPerUpdate()     - Nodes created by one update (ceil(log2 n) + 1)
+ *   bytesPerUpdate()     - Arena bytes consumed by one version created with update/add
+ *   bytesUsed()          - Arena bytes used so far
+ *
+ * RANGE K-TH SMALLEST (values compressed to [0, n)):
+ *   PersistentSegmentTree pst(n, m);
+ *   vector<int> ver(m + 1, 0);
+ *   for (int i = 0; i < m; i++) ver[i + 1] = pst.add(ver[i], comp[i], 1);
+ *   int p = pst.kth(ver[l], ver[r + 1], k); // k-th smallest of a[l..r] is values[p]
+ *
+ * Nodes live in one contiguous pool with 32-bit child indices; node 0 is the shared empty node.
+ *
+ * Time: O(log n) per update/query/kth, O(n) build
+ * Space: 16 bytes per node, O(n + U log n) nodes for U updates
+ */
+
+struct PersistentSegmentTree {
+    struct Node {
+        ll sum;
+        uint32_t l, r;
+    };
+
+    int n;
+    vector<Node> pool;
+    vector<uint32_t> roots;
+
+    PersistentSegmentTree(int n, int maxUpdates = 0) : n(n) {
+        pool.reserve(2 * (size_t)n + (size_t)maxUpdates * nodesPerUpdate() + 1);
+        pool.push_back({0, 0, 0});
+        roots.push_back(0);
+    }
+
+    uint32_t newNode(ll sum, uint32_t l, uint32_t r) {
+        pool.push_back({sum, l, r});
+        return pool.size() - 1;
+    }
+
+    uint32_t build(const vll& a, int tl, int tr) {
+        if (tl == tr) return newNode(a[tl], 0, 0);
+        int tm = (tl + tr) / 2;
+        uint32_t l = build(a, tl, tm);
+        uint32_t r = build(a, tm + 1, tr);
+        return newNode(pool[l].sum + pool[r].sum, l, r);
+    }
+
+    uint32_t update(uint32_t v, int tl, int tr, int pos, ll val, bool isAdd) {
+        if (tl == tr) return newNode(isAdd ? pool[v].sum + val : val, 0, 0);
+        int tm = (tl + tr) / 2;
+        uint32_t l = pool[v].l, r = pool[v].r;
+        if (pos <= tm) l = update(l, tl, tm, pos, val, isAdd);
+        else r = update(r, tm + 1, tr, pos, val, isAdd);
+        return newNode(pool[l].sum + pool[r].sum, l, r);
+    }
+
+    ll query(uint32_t v, int tl, int tr, int l, int r) {
+        if (l > r || v == 0) return 0;
+        if (l == tl && r == tr) return pool[v].sum;
+        int tm = (tl + tr) / 2;
+        return query(pool[v].l, tl, tm, l, min(r, tm))
+             + query(pool[v].r, tm + 1, tr, max(l, tm + 1), r);
+    }
+
+    int build(const vll& a) {
+        roots.push_back(build(a, 0, n - 1));
+        return roots.size() - 1;
+    }
+    int update(int ver, int pos, ll val) {
+        roots.push_back(update(roots[ver], 0, n - 1, pos, val, false));
+        return roots.size() - 1;
+    }
+    int add(int ver, int pos, ll delta) {
+        roots.push_back(update(roots[ver], 0, n - 1, pos, delta, true));
+        return roots.size() - 1;
+    }
+    ll query(int ver, int l, int r) { return query(roots[ver], 0, n - 1, l, r); }
+
+    int kth(int verL, int verR, ll k) {
+        uint32_t a = roots[verL], b = roots[verR];
+        int tl = 0, tr = n - 1;
+        while (tl < tr) {
+            int tm = (tl + tr) / 2;
+            ll left = pool[pool[b].l].sum - pool[pool[a].l].sum;
+            if (k <= left) {
+                a = pool[a].l; b = pool[b].l;
+                tr = tm;
+            } else {
+                k -= left;
+                a = pool[a].r; b = pool[b].r;
+                tl = tm + 1;
+            }
+        }
+        return tl;
+    }
+
+    int nodesPerUpdate() const {
+        int d = 1;
+        while ((1 << (d - 1)) < n) d++;
+        return d;
+    }
+    size_t bytesPerUpdate() const { return nodesPerUpdate() * sizeof(Node); }
+    size_t bytesUsed() const { return pool.size() * sizeof(Node); }
+};
@@ -0,0 +1,102 @@
+#include <bits/stdc++.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+using namespace std;
+
+typedef long long ll;
+typedef vector<ll> vll;
+
+/*
+ * WIDE SEGMENT TREE - 16-ary static-shape tree for prefix / range sums (read-heavy)
+ *
+ * Constructor:
+ *   WideSegmentTree(n) - Creates tree for n elements, all zeros
+ *
+ * Functions:
+ *   build(a)        - Initialize tree with array a (0-indexed) in O(n)
+ *   add(pos, x)     - a[pos] += x
+ *   update(pos, v)  - a[pos] = v
+ *   prefix(k)       - Sum of a[0..k-1] (0 <= k <= n)
+ *   query(l, r)     - Sum of a[l..r]
+ *
+ * Layout: nodes hold 16 long longs (two cache lines, 64-byte aligned), stored level
+ * by level (leaves first). Entry j of a node is the sum of its children before j,
+ * so prefix(k) reads a single entry per level and never reduces inside a node.
+ * add() does the per-node work instead: a masked add over the 16 entries,
+ * done with AVX2 when compiled with -mavx2 (or #pragma GCC target("avx2")).
+ *
+ * Time: O(log_16 n) per operation, O(n) build
+ * Space: ~1.07 n long longs
+ */
+
+struct WideSegmentTree {
+    static const int B = 16, LOGB = 4;
+
+    int n, H;
+    vector<int> off;
+    ll* t = nullptr;
+
+    WideSegmentTree(int n) : n(n) {
+        H = 1;
+        while ((n >> (LOGB * H)) > 0) H++;
+        off.assign(H + 1, 0);
+        for (int h = 0; h < H; h++) {
+            off[h + 1] = off[h] + ((n >> (LOGB * h + LOGB)) + 1) * B;
+        }
+        size_t bytes = ((size_t)off[H] * sizeof(ll) + 63) / 64 * 64;
+        t = (ll*)aligned_alloc(64, bytes);
+        memset(t, 0, bytes);
+    }
+    ~WideSegmentTree() { free(t); }
+    WideSegmentTree(const WideSegmentTree&) = delete;
+    WideSegmentTree& operator=(const WideSegmentTree&) = delete;
+
+    void build(const vll& a) {
+        vll tot(a.begin(), a.end());
+        for (int h = 0; h < H; h++) {
+            int cnt = off[h + 1] - off[h];
+            tot.resize(cnt, 0);
+            vll next(cnt / B);
+            for (int i = 0; i < cnt; i += B) {
+                ll s = 0;
+                for (int j = 0; j < B; j++) {
+                    t[off[h] + i + j] = s;
+                    s += tot[i + j];
+                }
+                next[i / B] = s;
+            }
+            tot.swap(next);
+        }
+    }
+
+    ll prefix(int k) const {
+        ll res = 0;
+        for (int h = 0; h < H; h++) res += t[off[h] + (k >> (LOGB * h))];
+        return res;
+    }
+
+    void add(int pos, ll x) {
+        for (int h = 0; h < H; h++) {
+            int e = pos >> (LOGB * h);
+            ll* node = t + off[h] + (e & ~(B - 1));
+            int slot = e & (B - 1);
+#ifdef __AVX2__
+            const __m256i idx[4] = {
+                _mm256_setr_epi64x(0, 1, 2, 3), _mm256_setr_epi64x(4, 5, 6, 7),
+                _mm256_setr_epi64x(8, 9, 10, 11), _mm256_setr_epi64x(12, 13, 14, 15)};
+            __m256i s = _mm256_set1_epi64x(slot), v = _mm256_set1_epi64x(x);
+            for (int j = 0; j < 4; j++) {
+                __m256i* p = (__m256i*)node + j;
+                __m256i mask = _mm256_cmpgt_epi64(idx[j], s);
+                _mm256_store_si256(p, _mm256_add_epi64(_mm256_load_si256(p), _mm256_and_si256(mask, v)));
+            }
+#else
+            for (int j = 0; j < B; j++) node[j] += (j > slot) ? x : 0;
+#endif
+        }
+    }
+
+    void update(int pos, ll v) { add(pos, v - query(pos, pos)); }
+    ll query(int l, int r) const { return prefix(r + 1) - prefix(l); }
+};
@@ -1,52 +1,72 @@
 /**
- * SUFFIX ARRAY + LCP + SPARSE TABLE
- * ---------------------------------
+ * SUFFIX ARRAY + LCP + LINEAR RMQ
+ * -------------------------------
  * Algorithm:   Prefix Doubling (O(N log N)) + Kasai's Algorithm (O(N))
  * Description: Builds SA and LCP array. Sentinel '$' is appended to the END.
- *              Includes O(1) LCP queries via Sparse Table.
+ *              Includes O(1) LCP queries via an O(N)-memory RMQ (see DataStructures/LinearRMQ.cpp).
  * 
  * METHODS:
  *   query(i, j)            : LCP of suffixes at i and j. O(1)
  *   compare(i, l1, j, l2)  : Compare s[i..i+l1-1] vs s[j..j+l2-1]. Returns -1, 0, 1. O(1)
  *   find(P)                : Find all starting indices of pattern P. O(|P| log N)
  *   countDistinct()        : Count distinct substrings. O(N)
+ *   rmq.a                  : The LCP array (lcp[i] = LCP of suffixes sa[i - 1] and sa[i]).
+ *                            Moved into the RMQ, not copied.
  * 
- * COMPLEXITY: Build O(N log N), Space O(N log N)
+ * COMPLEXITY: Build O(N log N), Space O(N)
  */
 
 #include <bits/stdc++.h>
 using namespace std;
 
 template<typename T>
-struct SparseTable {
-    vector<vector<T>> table;
-    int n;
-    SparseTable() {}
-    SparseTable(const vector<T>& a) : n(a.size()) {
+struct LinearRMQ {
+    static const int B = 32;
+    int n = 0, nb = 0;
+    vector<T> a, table;
+    vector<uint32_t> mask;
+    LinearRMQ() {}
+    LinearRMQ(vector<T> v) : n(v.size()), a(move(v)), mask(n) {
         if (n == 0) return;
-        int maxLog = 32 - __builtin_clz(n);
-        table.assign(maxLog, vector<T>(n));
-        for (int i = 0; i < n; i++) table[0][i] = a[i];
-        for (int j = 1; j < maxLog; j++)
-            for (int i = 0; i + (1 << j) <= n; i++)
-                table[j][i] = min(table[j - 1][i], table[j - 1][i + (1 << (j - 1))]);
+        nb = (n + B - 1) / B;
+        int levels = 32 - __builtin_clz(nb);
+        table.resize((size_t)levels * nb);
+        for (int b = 0; b < nb; b++) {
+            int s = b * B, e = min(n, s + B);
+            uint32_t cur = 0;
+            for (int i = s; i < e; i++) {
+                while (cur && a[s + 31 - __builtin_clz(cur)] >= a[i]) cur ^= 1u << (31 - __builtin_clz(cur));
+                cur |= 1u << (i - s);
+                mask[i] = cur;
+            }
+            table[b] = a[s + __builtin_ctz(cur)];
+        }
+        for (int j = 1; j < levels; j++)
+            for (int i = 0; i + (1 << j) <= nb; i++)
+                table[(size_t)j * nb + i] = min(table[(size_t)(j - 1) * nb + i], table[(size_t)(j - 1) * nb + i + (1 << (j - 1))]);
     }
-    T query(int l, int r) {
-        int k = 31 - __builtin_clz(r - l + 1);
-        return min(table[k][l], table[k][r - (1 << k) + 1]);
+    T small(int l, int r) const { return a[l + __builtin_ctz(mask[r] >> (l % B))]; }
+    T query(int l, int r) const {
+        int bl = l / B, br = r / B;
+        if (bl == br) return small(l, r);
+        T res = min(small(l, bl * B + B - 1), small(br * B, r));
+        if (bl + 1 < br) {
+            int k = 31 - __builtin_clz(br - bl - 1);
+            res = min(res, min(table[(size_t)k * nb + bl + 1], table[(size_t)k * nb + br - (1 << k)]));
+        }
+        return res;
     }
 };
 
 struct SuffixArray {
     string s;
     int n;
-    vector<int> sa, rk, lcp;
-    SparseTable<int> rmq;
+    vector<int> sa, rk;
+    LinearRMQ<int> rmq; // owns the LCP array: lcp[i] is rmq.a[i]
 
     SuffixArray(string _s) : s(_s + '$'), n(s.size()) {
         buildSA();
-        buildLCP();
-        rmq = SparseTable<int>(lcp);
+        rmq = LinearRMQ<int>(buildLCP());
     }
 
     void buildSA() {
@@ -83,8 +103,8 @@ struct SuffixArray {
         }
     }
 
-    void buildLCP() {
-        lcp.assign(n, 0);
+    vector<int> buildLCP() {
+        vector<int> lcp(n, 0);
         int k = 0;
         for (int i = 0; i < n; i++) {
             if (rk[i] == 0) continue;
@@ -93,6 +113,7 @@ struct SuffixArray {
             lcp[rk[i]] = k;
             if (k > 0) k--;
         }
+        return lcp;
     }
 
     int query(int i, int j) {
@@ -131,7 +152,7 @@ struct SuffixArray {
     long long countDistinctSubstrings() {
         long long total = 0;
         for (int i = 1; i < n; i++) 
-            total += (n - 1 - sa[i]) - lcp[i];
+            total += (n - 1 - sa[i]) - rmq.a[i];
         return total;
     }
 };
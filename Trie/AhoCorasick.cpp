@@ -0,0 +1,123 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+ * AHO-CORASICK - Multi-pattern streaming matcher built on a trie
+ *
+ * Constructor:
+ *   AhoCorasick() - Creates empty automaton
+ *
+ * Functions:
+ *   add(p)              - Add pattern p (any bytes, non-empty), returns its id (0, 1, ...)
+ *   build()             - Compute failure links, dense goto table and output links.
+ *                         Call once after all add() and before feed()
+ *   feed(data, len, cb) - Scan len bytes, continuing from the state left by the previous
+ *                         call. For every occurrence calls cb(id, end) where end is the
+ *                         offset of the LAST byte of the match in the whole stream
+ *   reset()             - Start a new stream (state and offset back to 0)
+ *
+ * USAGE:
+ *   AhoCorasick ac;
+ *   for (auto& p : patterns) ac.add(p);
+ *   ac.build();
+ *   while (read chunk) ac.feed(buf, len, [&](int id, long long end) { hits[id]++; });
+ *
+ * Bytes that appear in no pattern share one alphabet class, so the goto table has
+ * (distinct pattern bytes + 1) ints per node. Each transition stores the target row and
+ * a "some pattern ends here" bit, so bytes without a match cost one table read.
+ * Patterns ending at a node are chained through output links; feed() never allocates.
+ *
+ * Time: build O(total pattern length * sigma), feed O(len + matches)
+ */
+
+struct AhoCorasick {
+    int sigma = 1;
+    array<int, 256> cls{};       // byte -> alphabet class (0 = not in any pattern)
+    vector<string> patterns;
+    vector<int> go, fail, dict;  // dict = nearest proper suffix with a pattern
+    vector<int> out;             // v if a pattern ends at v, else dict[v]
+    vector<int> first, nextSame; // patterns ending at node v: first[v], nextSame[first[v]], ...
+    int state = 0;
+    long long offset = 0;
+
+    int add(const string& p) {
+        patterns.push_back(p);
+        return patterns.size() - 1;
+    }
+
+    void build() {
+        cls.fill(0);
+        sigma = 1;
+        for (auto& p : patterns)
+            for (unsigned char ch : p)
+                if (!cls[ch]) cls[ch] = sigma++;
+
+        // Trie with dense rows (0 = missing, the root is never a child)
+        go.assign(sigma, 0);
+        first.assign(1, -1);
+        nextSame.assign(patterns.size(), -1);
+        for (int id = 0; id < (int)patterns.size(); id++) {
+            int cur = 0;
+            for (unsigned char ch : patterns[id]) {
+                int c = cls[ch];
+                if (!go[cur * sigma + c]) {
+                    go[cur * sigma + c] = first.size();
+                    go.resize(go.size() + sigma, 0);
+                    first.push_back(-1);
+                }
+                cur = go[cur * sigma + c];
+            }
+            nextSame[id] = first[cur];
+            first[cur] = id;
+        }
+
+        // BFS: failure links, then fill missing transitions from the failure state
+        int nodes = first.size();
+        fail.assign(nodes, 0);
+        dict.assign(nodes, 0);
+        vector<int> q;
+        q.reserve(nodes);
+        for (int c = 0; c < sigma; c++)
+            if (go[c]) q.push_back(go[c]);
+        for (size_t qi = 0; qi < q.size(); qi++) {
+            int v = q[qi];
+            int f = fail[v];
+            dict[v] = first[f] >= 0 ? f : dict[f];
+            for (int c = 0; c < sigma; c++) {
+                int& u = go[v * sigma + c];
+                if (u) {
+                    fail[u] = go[f * sigma + c];
+                    q.push_back(u);
+                } else {
+                    u = go[f * sigma + c];
+                }
+            }
+        }
+
+        // Pack each transition as (target row << 1) | (target has output)
+        out.assign(nodes, 0);
+        for (int v = 1; v < nodes; v++) out[v] = first[v] >= 0 ? v : dict[v];
+        for (int& u : go) u = (u * sigma) << 1 | (out[u] > 0);
+        reset();
+    }
+
+    void reset() {
+        state = 0;
+        offset = 0;
+    }
+
+    template<typename F>
+    void feed(const char* data, size_t len, F&& cb) {
+        int row = state * sigma;
+        const int* g = go.data();
+        for (size_t i = 0; i < len; i++) {
+            int x = g[row + cls[(unsigned char)data[i]]];
+            row = x >> 1;
+            if (!(x & 1)) continue;
+            for (int v = out[row / sigma]; v > 0; v = dict[v])
+                for (int id = first[v]; id >= 0; id = nextSame[id]) cb(id, offset + (long long)i);
+        }
+        state = row / sigma;
+        offset += len;
+    }
+};
@@ -7,14 +7,28 @@ using namespace std;
  * BINARY TRIE - Trie for binary representations (useful for XOR problems)
  * 
  * Constructor:
- *   BinaryTrie(maxlog) - Creates trie for numbers with up to maxlog bits (default 30)
+ *   BinaryTrie(maxlog) - Creates trie for numbers with bits maxlog..0 (default 30, at most 62).
+ *                        Keys must satisfy 0 <= x < 2^(maxlog + 1)
  * 
  * Functions:
- *   insert(x)  - Insert number x into trie
- *   remove(x)  - Remove number x from trie (decrements count)
- *   maxXor(x)  - Returns maximum XOR of x with any number in trie
+ *   reserve(n)         - Preallocate room for n keys
+ *   insert(x)          - Insert number x into trie (multiset)
+ *   remove(x)          - Remove one copy of x, returns false if x is not present
+ *   count(x)           - Number of copies of x
+ *   size()             - Number of keys
+ *   xorAll(m)          - Replace every key a by a XOR m, in O(1)
+ *   maxXor(x)          - Returns maximum XOR of x with any number in trie
+ *   minXor(x)          - Returns minimum XOR of x with any number in trie
+ *   kthXor(x, k)       - k-th smallest (k is 1-indexed) value of x XOR a over the keys a,
+ *                        -1 if k > size()
+ *   countXorLess(x, k) - Number of keys a with (x XOR a) < k
+ *   (maxXor / minXor return -1 when the trie is empty)
  * 
- * Time: O(log max_value) per operation
+ * xorAll keeps a global tag: stored keys are a XOR tag, and every operation XORs its
+ * argument with the tag first. When a count drops to 0 the subtree is unlinked and put
+ * on a free list; insert reuses those nodes, so memory is bounded by the live keys.
+ * 
+ * Time: O(log max_value) per operation, O(1) for xorAll
  */
 
 struct BinaryTrie {
@@ -27,50 +41,143 @@ struct BinaryTrie {
     };
     
     vector<Node> nodes;
+    vector<int> freeList;
     int MAXLOG;
+    int tag = 0;
     
     BinaryTrie(int maxlog = 30) : MAXLOG(maxlog) {
         nodes.push_back(Node());
     }
     
+    void reserve(int n) {
+        nodes.reserve(n * (MAXLOG + 1) + 1);
+    }
+    
+    // Freed subtrees are pushed whole; their children are released when the node is reused
+    int newNode() {
+        if (freeList.empty()) {
+            nodes.push_back(Node());
+            return nodes.size() - 1;
+        }
+        int v = freeList.back();
+        freeList.pop_back();
+        for (int b = 0; b < 2; b++)
+            if (nodes[v].child[b] != -1) freeList.push_back(nodes[v].child[b]);
+        nodes[v] = Node();
+        return v;
+    }
+    
+    int size() {
+        return nodes[0].cnt;
+    }
+    
+    void xorAll(int m) {
+        tag ^= m;
+    }
+    
     void insert(int x) {
+        x ^= tag;
         int cur = 0;
+        nodes[0].cnt++;
         for (int i = MAXLOG; i >= 0; i--) {
             int bit = (x >> i) & 1;
             if (nodes[cur].child[bit] == -1) {
-                nodes[cur].child[bit] = nodes.size();
-                nodes.push_back(Node());
+                int v = newNode();
+                nodes[cur].child[bit] = v;
             }
             cur = nodes[cur].child[bit];
             nodes[cur].cnt++;
         }
     }
     
-    void remove(int x) {
+    int count(int x) {
+        x ^= tag;
         int cur = 0;
+        for (int i = MAXLOG; i >= 0; i--) {
+            cur = nodes[cur].child[(x >> i) & 1];
+            if (cur == -1) return 0;
+        }
+        return nodes[cur].cnt;
+    }
+    
+    bool remove(int x) {
+        if (count(x) == 0) return false;
+        x ^= tag;
+        int cur = 0;
+        nodes[0].cnt--;
         for (int i = MAXLOG; i >= 0; i--) {
             int bit = (x >> i) & 1;
-            if (nodes[cur].child[bit] == -1) return;
-            cur = nodes[cur].child[bit];
-            nodes[cur].cnt--;
+            int nxt = nodes[cur].child[bit];
+            if (--nodes[nxt].cnt == 0) {
+                nodes[cur].child[bit] = -1;
+                freeList.push_back(nxt);
+                return true;
+            }
+            cur = nxt;
         }
+        return true;
+    }
+    
+    // Greedy descent: at each bit prefer child (bit of x) ^ flip
+    int greedy(int x, int flip) {
+        if (size() == 0) return -1;
+        x ^= tag;
+        int cur = 0;
+        int result = 0;
+        for (int i = MAXLOG; i >= 0; i--) {
+            int want = ((x >> i) & 1) ^ flip;
+            if (nodes[cur].child[want] == -1) want ^= 1;
+            cur = nodes[cur].child[want];
+            if (want != ((x >> i) & 1)) result |= (1LL << i);
+        }
+        return result;
     }
     
     int maxXor(int x) {
+        return greedy(x, 1);
+    }
+    
+    int minXor(int x) {
+        return greedy(x, 0);
+    }
+    
+    int kthXor(int x, int k) {
+        if (k < 1 || k > size()) return -1;
+        x ^= tag;
         int cur = 0;
         int result = 0;
         for (int i = MAXLOG; i >= 0; i--) {
             int bit = (x >> i) & 1;
-            int want = 1 - bit;
-            if (nodes[cur].child[want] != -1 && nodes[nodes[cur].child[want]].cnt > 0) {
+            int same = nodes[cur].child[bit];
+            int c = same == -1 ? 0 : nodes[same].cnt;
+            if (k <= c) {
+                cur = same;
+            } else {
+                k -= c;
+                cur = nodes[cur].child[bit ^ 1];
                 result |= (1LL << i);
-                cur = nodes[cur].child[want];
-            } else if (nodes[cur].child[bit] != -1) {
-                cur = nodes[cur].child[bit];
+            }
+        }
+        return result;
+    }
+    
+    int countXorLess(int x, int k) {
+        if (k <= 0) return 0;
+        if (k >> (MAXLOG + 1)) return size();
+        x ^= tag;
+        int cur = 0;
+        int result = 0;
+        for (int i = MAXLOG; i >= 0 && cur != -1; i--) {
+            int bit = (x >> i) & 1;
+            if ((k >> i) & 1) {
+                // Keys whose XOR has a 0 here (and the same higher bits as k) are all smaller
+                int same = nodes[cur].child[bit];
+                if (same != -1) result += nodes[same].cnt;
+                cur = nodes[cur].child[bit ^ 1];
             } else {
-                return result;
+                cur = nodes[cur].child[bit];
             }
         }
         return result;
     }
-};
+};
\ No newline at end of file
@@ -0,0 +1,187 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+ * FLAT TRIE + DOUBLE-ARRAY TRIE - Trie with dense child arrays, frozen into base/check arrays
+ *
+ * Template:
+ *   K     - Alphabet size (26 for 'a'..'z', 256 for raw bytes)
+ *   BASE  - Code of the first character ('a' for K = 26, 0 for K = 256)
+ *
+ * FlatTrie<K, BASE>:
+ *   FlatTrie()          - Creates empty trie
+ *   reserve(nodes)      - Preallocate room for that many nodes
+ *   insert(s)           - Insert string s into trie. Returns false (and inserts nothing)
+ *                         if s has a character outside [BASE, BASE + K)
+ *   search(s)           - Returns true if exact string s exists in trie
+ *   startsWith(prefix)  - Returns true if any string starts with prefix
+ *   freeze()            - Returns a read-only DoubleArrayTrie with the same strings
+ *
+ * DoubleArrayTrie<K, BASE>:
+ *   search(s), startsWith(prefix) - Same as above
+ *   bytes()                       - Memory used by base + check
+ *
+ * FlatTrie keeps the children of node v in child[v * K .. v * K + K - 1] (0 = none),
+ * one pool for every node: a step is a single array read. The double-array form
+ * stores a node's children at base[v] + code and checks ownership with check[t] == v,
+ * using ~8 bytes per slot instead of 4K bytes per node. Code 0 marks end of word.
+ *
+ * Time: O(|s|) per operation. freeze(): O(nodes * K) in the worst case.
+ */
+
+template<int K, int BASE>
+struct DoubleArrayTrie {
+    vector<int> base, check;
+
+    int step(int cur, int code) const {
+        int t = base[cur] + code;
+        return (t < (int)check.size() && check[t] == cur) ? t : -1;
+    }
+
+    int walk(const string& s) const {
+        int cur = 0;
+        for (char ch : s) {
+            int c = (unsigned char)ch - BASE;
+            if (c < 0 || c >= K) return -1;
+            cur = step(cur, c + 1);
+            if (cur < 0) return -1;
+        }
+        return cur;
+    }
+
+    bool search(const string& s) const {
+        int cur = walk(s);
+        return cur >= 0 && step(cur, 0) >= 0;
+    }
+
+    bool startsWith(const string& prefix) const {
+        return walk(prefix) >= 0;
+    }
+
+    size_t bytes() const { return (base.size() + check.size()) * sizeof(int); }
+};
+
+template<int K = 26, int BASE = 'a'>
+struct FlatTrie {
+    vector<int> child;
+    vector<char> isEnd;
+
+    FlatTrie() : child(K, 0), isEnd(1, 0) {}
+
+    int size() const { return isEnd.size(); }
+
+    void reserve(int nodes) {
+        child.reserve((size_t)nodes * K);
+        isEnd.reserve(nodes);
+    }
+
+    bool insert(const string& s) {
+        for (char ch : s)
+            if ((unsigned char)ch - BASE < 0 || (unsigned char)ch - BASE >= K) return false;
+        int cur = 0;
+        for (char ch : s) {
+            int c = (unsigned char)ch - BASE;
+            if (!child[(size_t)cur * K + c]) {
+                child[(size_t)cur * K + c] = size();
+                child.resize(child.size() + K, 0);
+                isEnd.push_back(0);
+            }
+            cur = child[(size_t)cur * K + c];
+        }
+        isEnd[cur] = 1;
+        return true;
+    }
+
+    int walk(const string& s) const {
+        int cur = 0;
+        for (char ch : s) {
+            int c = (unsigned char)ch - BASE;
+            if (c < 0 || c >= K) return -1;
+            cur = child[(size_t)cur * K + c];
+            if (!cur) return -1;
+        }
+        return cur;
+    }
+
+    bool search(const string& s) const {
+        int cur = walk(s);
+        return cur >= 0 && isEnd[cur];
+    }
+
+    bool startsWith(const string& prefix) const {
+        return walk(prefix) >= 0;
+    }
+
+    DoubleArrayTrie<K, BASE> freeze() const {
+        DoubleArrayTrie<K, BASE> dat;
+        vector<int>& base = dat.base;
+        vector<int>& check = dat.check;
+        // Doubly linked list of free slots; index 0 is the root, never free.
+        // A slot that failed as first position too often leaves the list (it stays free).
+        vector<int> nxt, prv;
+        vector<char> fails;
+        int head = -1, tail = -1;
+        auto grow = [&](int need) {
+            int old = check.size();
+            if (need <= old) return;
+            int sz = max(need, 2 * old);
+            base.resize(sz, 0); check.resize(sz, -1);
+            nxt.resize(sz, -1); prv.resize(sz, -1); fails.resize(sz, 0);
+            for (int i = max(old, 1); i < sz; i++) {
+                prv[i] = tail;
+                if (tail >= 0) nxt[tail] = i; else head = i;
+                tail = i;
+            }
+        };
+        auto take = [&](int t) {
+            if (fails[t] < 0) return;
+            fails[t] = -1;
+            if (prv[t] >= 0) nxt[prv[t]] = nxt[t]; else head = nxt[t];
+            if (nxt[t] >= 0) prv[nxt[t]] = prv[t]; else tail = prv[t];
+        };
+
+        grow(max(2 * K + 2, 16));
+        check[0] = -2;
+        vector<pair<int, int>> q = {{0, 0}}; // (flat node, double-array index)
+        vector<int> codes;
+        for (size_t qi = 0; qi < q.size(); qi++) {
+            auto [v, d] = q[qi];
+            codes.clear();
+            if (isEnd[v]) codes.push_back(0);
+            for (int c = 0; c < K; c++)
+                if (child[(size_t)v * K + c]) codes.push_back(c + 1);
+            if (codes.empty()) continue;
+
+            int b;
+            for (int f = head;; ) {
+                if (f < 0) { // no free slot fits: grow and continue in the new region
+                    int old = check.size();
+                    grow(old + K + 1);
+                    f = max(old, 1);
+                }
+                b = f - codes[0];
+                bool ok = b >= 1;
+                for (size_t i = 1; ok && i < codes.size(); i++) {
+                    int t = b + codes[i];
+                    if (t >= (int)check.size()) grow(t + 1);
+                    ok = check[t] == -1;
+                }
+                if (ok) break;
+                int g = nxt[f];
+                if (++fails[f] >= 16) take(f);
+                f = g;
+            }
+            base[d] = b;
+            for (int code : codes) {
+                check[b + code] = d;
+                take(b + code);
+                if (code > 0) q.push_back({child[(size_t)v * K + code - 1], b + code});
+            }
+        }
+        int used = check.size();
+        while (used > 1 && check[used - 1] == -1) used--;
+        base.resize(used); check.resize(used);
+        base.shrink_to_fit(); check.shrink_to_fit();
+        return dat;
+    }
+};
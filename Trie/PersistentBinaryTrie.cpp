@@ -0,0 +1,98 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+/*
+ * PERSISTENT BINARY TRIE - One binary trie version per array prefix, for range XOR queries
+ *
+ * Constructor:
+ *   PersistentBinaryTrie(maxKeys, bits) - Empty version 0; reserves the pool for maxKeys
+ *                                         inserts of bits-bit keys (1 <= bits <= 64, default 64).
+ *                                         Keys are uint64_t and must be < 2^bits
+ *
+ * Functions:
+ *   build(a)          - Version i + 1 = version i plus a[i] (versions start from empty)
+ *   push(x)           - Add a new version = latest version plus x, returns its number
+ *   maxXor(l, r, x)   - max of x XOR a[i] for i in [l, r] (0-indexed, l <= r)
+ *   minXor(l, r, x)   - min of x XOR a[i] for i in [l, r]
+ *   count(l, r, x)    - Number of i in [l, r] with a[i] == x
+ *
+ * Each insert copies one path: bits + 1 nodes of 12 bytes (two 32-bit children and a
+ * count) from one flat pool, node 0 being the shared empty node. The keys in a[l..r]
+ * are exactly version r + 1 minus version l, so a query walks both roots together and
+ * uses the count difference to know whether a branch is non-empty.
+ *
+ * Time: O(bits) per insert and query. Space: (n * (bits + 1) + 1) * 12 bytes
+ */
+
+struct PersistentBinaryTrie {
+    struct Node {
+        uint32_t child[2];
+        uint32_t cnt;
+    };
+
+    int bits;
+    vector<Node> nodes;
+    vector<uint32_t> roots;
+
+    PersistentBinaryTrie(int maxKeys = 0, int bits = 64) : bits(bits) {
+        nodes.reserve((size_t)maxKeys * (bits + 1) + 1);
+        roots.reserve(maxKeys + 1);
+        nodes.push_back({{0, 0}, 0});
+        roots.push_back(0);
+    }
+
+    void build(const vector<uint64_t>& a) {
+        for (uint64_t x : a) push(x);
+    }
+
+    int push(uint64_t x) {
+        uint32_t prev = roots.back();
+        uint32_t cur = nodes.size();
+        Node nd = nodes[prev];
+        nd.cnt++;
+        nodes.push_back(nd);
+        roots.push_back(cur);
+        for (int i = bits - 1; i >= 0; i--) {
+            int b = (x >> i) & 1;
+            nd = nodes[nodes[cur].child[b]];
+            nd.cnt++;
+            nodes[cur].child[b] = nodes.size();
+            cur = nodes.size();
+            nodes.push_back(nd);
+        }
+        return roots.size() - 1;
+    }
+
+    // Greedy walk over a[l..r]: prefer the child with bit (x_bit ^ flip)
+    uint64_t walk(int l, int r, uint64_t x, int flip) const {
+        uint32_t lo = roots[l], hi = roots[r + 1];
+        uint64_t res = 0;
+        for (int i = bits - 1; i >= 0; i--) {
+            int want = ((x >> i) & 1) ^ flip;
+            uint32_t a = nodes[lo].child[want], b = nodes[hi].child[want];
+            if (nodes[b].cnt > nodes[a].cnt) {
+                if (flip) res |= 1ULL << i;
+            } else {
+                want ^= 1;
+                if (!flip) res |= 1ULL << i;
+                a = nodes[lo].child[want];
+                b = nodes[hi].child[want];
+            }
+            lo = a; hi = b;
+        }
+        return res;
+    }
+
+    uint64_t maxXor(int l, int r, uint64_t x) const { return walk(l, r, x, 1); }
+    uint64_t minXor(int l, int r, uint64_t x) const { return walk(l, r, x, 0); }
+
+    int count(int l, int r, uint64_t x) const {
+        uint32_t lo = roots[l], hi = roots[r + 1];
+        for (int i = bits - 1; i >= 0 && hi; i--) {
+            int b = (x >> i) & 1;
+            lo = nodes[lo].child[b];
+            hi = nodes[hi].child[b];
+        }
+        return nodes[hi].cnt - nodes[lo].cnt;
+    }
+};
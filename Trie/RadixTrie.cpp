@@ -0,0 +1,183 @@
+#include <bits/stdc++.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+using namespace std;
+
+/*
+ * RADIX TRIE (Patricia) - Compressed trie in a flat binary format, queried in place via mmap
+ *
+ * Building:
+ *   vector<char> blob = buildRadixTrie(words)  - Serialize the (de-duplicated) word list
+ *   saveRadixTrie(path, blob)                  - Write blob to disk, returns false on error
+ *
+ * Querying (no deserialization, works on the raw bytes):
+ *   RadixTrieView t;
+ *   t.open(path)          - mmap the file read-only, returns false on error / bad format
+ *   t.attach(ptr, size)   - Use bytes already in memory (e.g. the blob itself)
+ *   t.search(s)           - Returns true if exact string s was inserted
+ *   t.startsWith(prefix)  - Returns true if any word starts with prefix
+ *   t.countPrefix(prefix) - Number of words that start with prefix
+ *
+ * Chains of single-child nodes are merged into one edge with a multi-byte label.
+ * Format (little-endian, offsets relative to the start of the file, so it is
+ * position-independent):
+ *   Header { magic "RTRI", version, nodes, edges, labelBytes }
+ *   Node[nodes]  { firstEdge, edgeCount, words in subtree, isEnd }   (node 0 = root)
+ *   Edge[edges]  { labelOffset, labelLength, child, firstByte }      (sorted by firstByte)
+ *   char labels[labelBytes]
+ *
+ * Time: build O(total length + nodes log nodes) after sorting,
+ *       query O(|s| + log(alphabet) per node on the path)
+ */
+
+namespace radix {
+    struct Header { char magic[4]; uint32_t version, nodes, edges, labelBytes; };
+    struct Node { uint32_t firstEdge, edgeCount, words, isEnd; };
+    struct Edge { uint32_t label, len, child, first; };
+}
+
+vector<char> buildRadixTrie(vector<string> words) {
+    using namespace radix;
+    sort(words.begin(), words.end());
+    words.erase(unique(words.begin(), words.end()), words.end());
+
+    vector<Node> nodes;
+    vector<Edge> edges;
+    string labels;
+    // BFS over (node id, word range [lo, hi), depth); every word in the range shares words[lo][0..depth)
+    struct Item { int id, lo, hi, depth; };
+    vector<Item> q = {{0, 0, (int)words.size(), 0}};
+    nodes.push_back({0, 0, (uint32_t)words.size(), 0});
+    for (size_t qi = 0; qi < q.size(); qi++) {
+        auto [id, lo, hi, d] = q[qi];
+        if (lo < hi && (int)words[lo].size() == d) {
+            nodes[id].isEnd = 1;
+            lo++;
+        }
+        nodes[id].firstEdge = edges.size();
+        for (int i = lo; i < hi; ) {
+            char c = words[i][d];
+            int j = i + 1;
+            while (j < hi && words[j][d] == c) j++;
+            // Longest common prefix of the group = LCP(first, last) since words are sorted
+            const string &a = words[i], &b = words[j - 1];
+            int len = 1;
+            while (d + len < (int)min(a.size(), b.size()) && a[d + len] == b[d + len]) len++;
+            int child = nodes.size();
+            nodes.push_back({0, 0, (uint32_t)(j - i), 0});
+            edges.push_back({(uint32_t)labels.size(), (uint32_t)len, (uint32_t)child, (uint32_t)(unsigned char)c});
+            labels.append(a, d, len);
+            q.push_back({child, i, j, d + len});
+            i = j;
+        }
+        nodes[id].edgeCount = edges.size() - nodes[id].firstEdge;
+    }
+
+    Header h = {{'R', 'T', 'R', 'I'}, 1, (uint32_t)nodes.size(), (uint32_t)edges.size(), (uint32_t)labels.size()};
+    vector<char> blob(sizeof(Header) + nodes.size() * sizeof(Node) + edges.size() * sizeof(Edge) + labels.size());
+    char* p = blob.data();
+    auto put = [&](const void* src, size_t bytes) {
+        if (bytes) memcpy(p, src, bytes); // empty vectors may have a null data()
+        p += bytes;
+    };
+    put(&h, sizeof(Header));
+    put(nodes.data(), nodes.size() * sizeof(Node));
+    put(edges.data(), edges.size() * sizeof(Edge));
+    put(labels.data(), labels.size());
+    return blob;
+}
+
+bool saveRadixTrie(const string& path, const vector<char>& blob) {
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) return false;
+    bool ok = fwrite(blob.data(), 1, blob.size(), f) == blob.size();
+    return fclose(f) == 0 && ok;
+}
+
+struct RadixTrieView {
+    const radix::Node* nodes = nullptr;
+    const radix::Edge* edges = nullptr;
+    const char* labels = nullptr;
+    void* mapped = nullptr;
+    size_t mappedSize = 0;
+
+    RadixTrieView() {}
+    ~RadixTrieView() { close(); }
+    RadixTrieView(const RadixTrieView&) = delete;
+    RadixTrieView& operator=(const RadixTrieView&) = delete;
+
+    bool attach(const char* base, size_t size) {
+        using namespace radix;
+        if (size < sizeof(Header)) return false;
+        const Header* h = (const Header*)base;
+        if (memcmp(h->magic, "RTRI", 4) != 0 || h->version != 1) return false;
+        size_t need = sizeof(Header) + (size_t)h->nodes * sizeof(Node) + (size_t)h->edges * sizeof(Edge) + h->labelBytes;
+        if (size < need || h->nodes == 0) return false;
+        nodes = (const Node*)(base + sizeof(Header));
+        edges = (const Edge*)(nodes + h->nodes);
+        labels = (const char*)(edges + h->edges);
+        return true;
+    }
+
+    bool open(const string& path) {
+        close();
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) { ::close(fd); return false; }
+        void* p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED) return false;
+        mapped = p;
+        mappedSize = st.st_size;
+        if (!attach((const char*)p, mappedSize)) { close(); return false; }
+        return true;
+    }
+
+    void close() {
+        if (mapped) munmap(mapped, mappedSize);
+        mapped = nullptr;
+        mappedSize = 0;
+        nodes = nullptr;
+    }
+
+    // Node reached after reading s (-1 if none); partial = s ended in the middle of an edge
+    int walk(const string& s, bool& partial) const {
+        int cur = 0;
+        size_t i = 0;
+        partial = false;
+        while (i < s.size()) {
+            const radix::Node& nd = nodes[cur];
+            const radix::Edge* lo = edges + nd.firstEdge;
+            const radix::Edge* hi = lo + nd.edgeCount;
+            uint32_t c = (unsigned char)s[i];
+            const radix::Edge* e = lower_bound(lo, hi, c, [](const radix::Edge& x, uint32_t v) { return x.first < v; });
+            if (e == hi || e->first != c) return -1;
+            size_t m = min<size_t>(e->len, s.size() - i);
+            if (memcmp(labels + e->label, s.data() + i, m) != 0) return -1;
+            partial = m < e->len;
+            i += m;
+            cur = e->child;
+        }
+        return cur;
+    }
+
+    bool search(const string& s) const {
+        bool partial;
+        int v = walk(s, partial);
+        return v >= 0 && !partial && nodes[v].isEnd;
+    }
+
+    bool startsWith(const string& prefix) const {
+        bool partial;
+        return walk(prefix, partial) >= 0;
+    }
+
+    int countPrefix(const string& prefix) const {
+        bool partial;
+        int v = walk(prefix, partial);
+        return v < 0 ? 0 : nodes[v].words;
+    }
+};
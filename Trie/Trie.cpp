@@ -12,7 +12,22 @@ using namespace std;
  *   search(s)       - Returns true if exact string s exists in trie
  *   startsWith(prefix) - Returns true if any string starts with prefix
  * 
+ * Bulk build (static dictionary with autocomplete):
+ *   Trie::fromSorted(words, weights, K) - Builds from lexicographically sorted words
+ *                                         (duplicates keep the first weight) in one pass
+ *   countPrefix(prefix)       - Number of words starting with prefix
+ *   autocomplete(prefix, k)   - Up to min(k, K) words starting with prefix, by weight
+ *                               descending (ties: lexicographic)
+ * 
+ * fromSorted reuses the path of the previous word up to their LCP and only creates the
+ * new suffix, so nodes come out in DFS order and each subtree is the contiguous id range
+ * [v, v + subtree size). Per node it stores the subtree word count and the K best word
+ * ids; a node with a single child and no word shares its child's list.
+ * countPrefix / autocomplete only know the words given to fromSorted(): on a Trie built
+ * with insert(), or for nodes insert() adds afterwards, they return 0 / an empty list.
+ * 
  * Time: O(|s|) per operation where |s| is string length
+ *       fromSorted: O(total length + nodes * K), autocomplete: O(|prefix| + k)
  */
 
 struct Trie {
@@ -61,4 +76,94 @@ struct Trie {
         }
         return true;
     }
+    
+    // Filled by fromSorted()
+    vector<string> dict;
+    vector<long long> weight;
+    vector<int> cnt, topBegin, topLen, topPool;
+    
+    static Trie fromSorted(const vector<string>& words, const vector<long long>& weights, int K = 10) {
+        assert(is_sorted(words.begin(), words.end()));
+        Trie t;
+        vector<int> parent = {-1}, wordAt = {-1};
+        vector<int> path = {0};
+        for (size_t i = 0; i < words.size(); i++) {
+            const string& w = words[i];
+            if (!t.dict.empty() && w == t.dict.back()) continue;
+            size_t lcp = 0;
+            if (!t.dict.empty()) {
+                const string& prev = t.dict.back();
+                while (lcp < min(prev.size(), w.size()) && prev[lcp] == w[lcp]) lcp++;
+            }
+            path.resize(lcp + 1);
+            for (size_t j = lcp; j < w.size(); j++) {
+                int id = t.nodes.size();
+                t.nodes.push_back(Node());
+                parent.push_back(path.back());
+                wordAt.push_back(-1);
+                // Sorted input: the new child is the largest key so far
+                t.nodes[path.back()].child.emplace_hint(t.nodes[path.back()].child.end(), w[j], id);
+                path.push_back(id);
+            }
+            t.nodes[path.back()].isEnd = true;
+            wordAt[path.back()] = t.dict.size();
+            t.dict.push_back(w);
+            t.weight.push_back(weights[i]);
+        }
+        
+        // Children have larger ids than their parent: one reverse sweep is a post-order
+        int n = t.nodes.size();
+        t.cnt.assign(n, 0);
+        t.topBegin.assign(n, 0);
+        t.topLen.assign(n, 0);
+        auto better = [&](int a, int b) {
+            return t.weight[a] != t.weight[b] ? t.weight[a] > t.weight[b] : a < b;
+        };
+        vector<int> cand;
+        for (int v = n - 1; v >= 0; v--) {
+            Node& nd = t.nodes[v];
+            if (nd.isEnd) t.cnt[v]++;
+            if (parent[v] >= 0) t.cnt[parent[v]] += t.cnt[v];
+            if (!nd.isEnd && nd.child.size() == 1) {
+                int c = nd.child.begin()->second;
+                t.topBegin[v] = t.topBegin[c];
+                t.topLen[v] = t.topLen[c];
+                continue;
+            }
+            cand.clear();
+            if (nd.isEnd) cand.push_back(wordAt[v]);
+            for (auto& [ch, c] : nd.child)
+                cand.insert(cand.end(), t.topPool.begin() + t.topBegin[c], t.topPool.begin() + t.topBegin[c] + t.topLen[c]);
+            int take = min<int>(K, cand.size());
+            partial_sort(cand.begin(), cand.begin() + take, cand.end(), better);
+            t.topBegin[v] = t.topPool.size();
+            t.topLen[v] = take;
+            t.topPool.insert(t.topPool.end(), cand.begin(), cand.begin() + take);
+        }
+        return t;
+    }
+    
+    int walk(const string& prefix) {
+        int cur = 0;
+        for (char c : prefix) {
+            auto it = nodes[cur].child.find(c);
+            if (it == nodes[cur].child.end()) return -1;
+            cur = it->second;
+        }
+        return cur;
+    }
+    
+    int countPrefix(const string& prefix) {
+        int cur = walk(prefix);
+        return cur < 0 || cur >= (int)cnt.size() ? 0 : cnt[cur];
+    }
+    
+    vector<string> autocomplete(const string& prefix, int k) {
+        vector<string> res;
+        int cur = walk(prefix);
+        if (cur < 0 || cur >= (int)topLen.size()) return res;
+        int take = min(k, topLen[cur]);
+        for (int i = 0; i < take; i++) res.push_back(dict[topPool[topBegin[cur] + i]]);
+        return res;
+    }
 };